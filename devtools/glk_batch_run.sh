@@ -0,0 +1,88 @@
+#!/bin/sh
+#
+# glk_batch_run.sh - replay a command script through a Glk game
+#
+# ScummVM is the legal property of its developers, whose names
+# are too numerous to list here. Please refer to the COPYRIGHT
+# file distributed with this source distribution.
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+#
+#
+# Runs a story file in the Glk engine's batch mode, feeding it one line of
+# the command script each time the game waits for input. The text the game
+# printed is compared with the expected transcript, if one is given, or
+# written to stdout otherwise, so it can be checked and kept as the
+# expected transcript of later runs. The time taken by each command is
+# printed either way.
+#
+# Exits with 0 when the transcripts match, 1 when they differ or the game
+# did not produce a transcript, and 2 on bad arguments.
+#
+# The scummvm binary is taken from $SCUMMVM, and defaults to ./scummvm.
+# fonts.dat has to be found by ScummVM, e.g. next to the story file.
+
+if [ $# -lt 3 ] || [ $# -gt 4 ]; then
+	echo "Usage: $0 <game id> <story file> <command script> [<expected transcript>]" >&2
+	echo "The game id selects the interpreter, e.g. zcode or glulx for unknown story files." >&2
+	exit 2
+fi
+
+SCUMMVM=${SCUMMVM:-./scummvm}
+
+absolute() {
+	echo "$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+}
+
+story=$(absolute "$2")
+commands=$(absolute "$3")
+if [ ! -f "$story" ] || [ ! -f "$commands" ]; then
+	echo "$0: cannot find $2 or $3" >&2
+	exit 2
+fi
+
+workdir=$(mktemp -d)
+trap 'rm -rf "$workdir"' EXIT
+
+cat > "$workdir/scummvm.ini" <<END
+[scummvm]
+gfx_mode=normal
+
+[glkbatch]
+engineid=glk
+gameid=$1
+path=$(dirname "$story")
+filename=$(basename "$story")
+glk_batch_input=$commands
+glk_batch_output=$workdir/transcript.txt
+END
+
+# SDL builds get neither a window nor sound output. The timings go to
+# stderr, so that stdout only carries the transcript.
+(SDL_VIDEODRIVER=${SDL_VIDEODRIVER:-dummy} SDL_AUDIODRIVER=${SDL_AUDIODRIVER:-dummy} \
+	"$SCUMMVM" --config="$workdir/scummvm.ini" glkbatch < /dev/null 2>&1) 2> /dev/null | grep "^Batch run:" >&2
+
+# Only the transcript is checked, not how scummvm exited
+if [ ! -f "$workdir/transcript.txt" ]; then
+	echo "$0: the game did not write a transcript" >&2
+	exit 1
+fi
+
+if [ $# -eq 3 ]; then
+	cat "$workdir/transcript.txt"
+	exit 0
+fi
+
+diff -u "$4" "$workdir/transcript.txt" || exit 1
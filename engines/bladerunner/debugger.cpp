@@ -45,6 +45,7 @@
 #include "bladerunner/settings.h"
 #include "bladerunner/set.h"
 #include "bladerunner/set_effects.h"
+#include "bladerunner/slice_animations.h"
 #include "bladerunner/text_resource.h"
 #include "bladerunner/time.h"
 #include "bladerunner/vector.h"
@@ -137,6 +138,7 @@ Debugger::Debugger(BladeRunnerEngine *vm) : GUI::Debugger() {
 	registerCmd("region", WRAP_METHOD(Debugger, cmdRegion));
 	registerCmd("click", WRAP_METHOD(Debugger, cmdClick));
 	registerCmd("difficulty", WRAP_METHOD(Debugger, cmdDifficulty));
+	registerCmd("slicecache", WRAP_METHOD(Debugger, cmdSliceCache));
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	registerCmd("effect", WRAP_METHOD(Debugger, cmdEffect));
@@ -1927,6 +1929,38 @@ bool Debugger::cmdDifficulty(int argc, const char **argv) {
 	}
 	return true;
 }
+
+bool Debugger::cmdSliceCache(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Show slice animation page cache statistics, or set its size limit in MB (0 for no limit)\n");
+		debugPrintf("Usage: %s [<limit>]\n", argv[0]);
+		return true;
+	}
+
+	SliceAnimations *sliceAnimations = _vm->_sliceAnimations;
+
+	if (argc == 2) {
+		int limit = atoi(argv[1]);
+		if (limit < 0 || limit > SliceAnimations::kMaxCacheBudgetMB) {
+			debugPrintf("The limit must be between 0 and %d\n", SliceAnimations::kMaxCacheBudgetMB);
+			return true;
+		}
+		sliceAnimations->setCacheBudgetMB(limit);
+	}
+
+	const SliceAnimations::CacheStats &stats = sliceAnimations->getCacheStats();
+	uint32 budget = sliceAnimations->getCacheBudget();
+
+	debugPrintf("Pages loaded: %d (%d KB)\n", sliceAnimations->getCachedPageCount(), sliceAnimations->getCacheSize() / 1024);
+	if (budget == 0) {
+		debugPrintf("Limit: none\n");
+	} else {
+		debugPrintf("Limit: %d KB\n", budget / 1024);
+	}
+	debugPrintf("Hits: %d, misses: %d, preloaded: %d, evicted: %d\n", stats.hits, stats.misses, stats.preloaded, stats.evictions);
+	return true;
+}
+
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 bool Debugger::cmdEffect(int argc, const char **argv) {
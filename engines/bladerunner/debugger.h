@@ -115,6 +115,7 @@ public:
 	bool cmdRegion(int argc, const char **argv);
 	bool cmdClick(int argc, const char **argv);
 	bool cmdDifficulty(int argc, const char **argv);
+	bool cmdSliceCache(int argc, const char **argv);
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	bool cmdEffect(int argc, const char **argv);
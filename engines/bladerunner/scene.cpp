@@ -184,6 +184,9 @@ bool Scene::open(int setId, int sceneId, bool isLoadingGame) {
 			// ensure that actors' "hotspot" areas from previous scene are cleared up
 			actor->resetScreenRectangleAndBbox();
 #endif
+			// load the pages of the current animation now instead of on the first frame drawn
+			_vm->_sliceRenderer->preload(actor->getAnimationId());
+
 			_vm->_sceneObjects->addActor(
 				i + kSceneObjectOffsetActors,
 				actor->getBoundingBox(),
@@ -25,6 +25,7 @@
 #include "bladerunner/bladerunner.h"
 #include "bladerunner/time.h"
 
+#include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/system.h"
@@ -81,6 +82,11 @@ bool SliceAnimations::open(const Common::String &name) {
 	for (uint32 i = 0; i != _pageCount; ++i)
 		_pages[i]._data = nullptr;
 
+	// Optional limit (in MB) for the loaded pages, least recently used pages get evicted
+	if (ConfMan.hasKey("slice_cache_size")) {
+		setCacheBudgetMB(ConfMan.getInt("slice_cache_size"));
+	}
+
 	return true;
 }
 
@@ -220,8 +226,6 @@ void *SliceAnimations::PageFile::loadPage(uint32 pageNumber) {
 
 	uint32 pageSize = _sliceAnimations->_pageSize;
 
-	// TODO: Retire oldest pages if we exceed some memory limit
-
 	void *data = malloc(pageSize);
 	_files[_pageOffsetsFileIdx[pageNumber]].seek(_pageOffsets[pageNumber], SEEK_SET);
 	uint32 r = _files[_pageOffsetsFileIdx[pageNumber]].read(data, pageSize);
@@ -259,20 +263,114 @@ void *SliceAnimations::getFramePtr(uint32 animation, uint32 frame) {
 	uint32 pageOffset  = frameOffset % _pageSize;
 
 	if (_pages[page]._data == nullptr) {                          // if not cached already
-		_pages[page]._data = _coreAnimPageFile.loadPage(page);    // look in COREANIM first
+		++_cacheStats.misses;
+		if (!loadPage(page)) {
+			error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
+		}
+	} else {
+		++_cacheStats.hits;
+		touchPage(page);
+	}
 
-		if (_pages[page]._data == nullptr) {                      // if not in COREAMIM
-			_pages[page]._data = _framesPageFile.loadPage(page);  // Look in CDFRAMES or HDFRAMES loaded data
+	return (byte *)_pages[page]._data + pageOffset;
+}
 
-			if (_pages[page]._data == nullptr) {
-				error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
-			}
+void SliceAnimations::preload(int animation) {
+	if (animation < 0 || animation >= (int)_animations.size() || _animations[animation].frameCount == 0) {
+		return;
+	}
+
+	// Frames of an animation are stored back to back, so they occupy a contiguous range of pages
+	const Animation &anim = _animations[animation];
+	uint32 firstPage = anim.offset / _pageSize;
+	uint32 lastPage  = (anim.offset + anim.frameCount * anim.frameSize - 1) / _pageSize;
+
+	for (uint32 page = firstPage; page <= lastPage && page < _pageCount; ++page) {
+		if (_pages[page]._data != nullptr) {
+			touchPage(page);
+		} else if (loadPage(page)) {
+			++_cacheStats.preloaded;
 		}
 	}
+}
+
+void SliceAnimations::setCacheBudget(uint32 bytes) {
+	_cacheBudget = bytes;
+	evictPages(_lruHead);
+}
 
-	_pages[page]._lastAccess = _vm->_time->currentSystem();
+bool SliceAnimations::loadPage(uint32 page) {
+	void *data = _coreAnimPageFile.loadPage(page);    // look in COREANIM first
 
-	return (byte *)_pages[page]._data + pageOffset;
+	if (data == nullptr) {                           // if not in COREAMIM
+		data = _framesPageFile.loadPage(page);       // Look in CDFRAMES or HDFRAMES loaded data
+
+		if (data == nullptr) {
+			return false;
+		}
+	}
+
+	_pages[page]._data = data;
+	++_cachedPageCount;
+
+	touchPage(page);
+	evictPages(page);
+
+	return true;
+}
+
+void SliceAnimations::touchPage(uint32 page) {
+	if (_lruHead == (int32)page) {
+		return;
+	}
+
+	unlinkPage(page);
+
+	_pages[page]._lruNext = _lruHead;
+	if (_lruHead != -1) {
+		_pages[_lruHead]._lruPrev = page;
+	}
+	_lruHead = page;
+	if (_lruTail == -1) {
+		_lruTail = page;
+	}
+}
+
+void SliceAnimations::unlinkPage(uint32 page) {
+	Page &p = _pages[page];
+
+	if (p._lruPrev != -1) {
+		_pages[p._lruPrev]._lruNext = p._lruNext;
+	} else if (_lruHead == (int32)page) {
+		_lruHead = p._lruNext;
+	} else {
+		return; // not in the list
+	}
+
+	if (p._lruNext != -1) {
+		_pages[p._lruNext]._lruPrev = p._lruPrev;
+	} else {
+		_lruTail = p._lruPrev;
+	}
+
+	p._lruPrev = -1;
+	p._lruNext = -1;
+}
+
+void SliceAnimations::evictPages(int32 keepPage) {
+	if (_cacheBudget == 0) {
+		return;
+	}
+
+	// The slice renderer only holds on to the frame it got last, so every other page can go
+	while (_cachedPageCount * _pageSize > _cacheBudget && _lruTail != -1 && _lruTail != keepPage) {
+		uint32 page = _lruTail;
+		unlinkPage(page);
+		free(_pages[page]._data);
+		_pages[page]._data = nullptr;
+		--_cachedPageCount;
+		++_cacheStats.evictions;
+	}
 }
 
 Vector3 SliceAnimations::getPositionChange(int animation) const {
@@ -58,9 +58,10 @@ class SliceAnimations {
 
 	struct Page {
 		void   *_data;
-		uint32 _lastAccess;
+		int32  _lruPrev; // more recently used page, -1 if none
+		int32  _lruNext; // less recently used page, -1 if none
 
-		Page() : _data(nullptr), _lastAccess(0) {}
+		Page() : _data(nullptr), _lruPrev(-1), _lruNext(-1) {}
 	};
 
 	struct PageFile {
@@ -88,9 +89,28 @@ class SliceAnimations {
 	Common::Array<Animation>    _animations;
 	Common::Array<Page>         _pages;
 
+	// Loaded pages, from most to least recently used
+	int32  _lruHead;
+	int32  _lruTail;
+	uint32 _cachedPageCount;
+	uint32 _cacheBudget; // in bytes, 0 for no limit
+
 	PageFile _coreAnimPageFile;
 	PageFile _framesPageFile;
 
+public:
+	struct CacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 evictions;
+		uint32 preloaded;
+
+		CacheStats() : hits(0), misses(0), evictions(0), preloaded(0) {}
+	};
+
+private:
+	CacheStats _cacheStats;
+
 public:
 	SliceAnimations(BladeRunnerEngine *vm)
 		: _vm(vm)
@@ -99,7 +119,11 @@ public:
 		, _timestamp(0)
 		, _pageSize(0)
 		, _pageCount(0)
-		, _paletteCount(0) {}
+		, _paletteCount(0)
+		, _lruHead(-1)
+		, _lruTail(-1)
+		, _cachedPageCount(0)
+		, _cacheBudget(0) {}
 	~SliceAnimations();
 
 	bool open(const Common::String &name);
@@ -110,11 +134,29 @@ public:
 	Palette &getPalette(int i) { return _palettes[i]; };
 	void    *getFramePtr(uint32 animation, uint32 frame);
 
+	void preload(int animation);
+
+	// The budget is kept in bytes, so limits given in MB are clamped to what fits
+	static const int kMaxCacheBudgetMB = 4095;
+
+	void   setCacheBudget(uint32 bytes);
+	void   setCacheBudgetMB(int megabytes) { setCacheBudget((uint32)CLIP(megabytes, 0, kMaxCacheBudgetMB) * 1024 * 1024); }
+	uint32 getCacheBudget() const { return _cacheBudget; }
+	uint32 getCacheSize() const { return _cachedPageCount * _pageSize; }
+	uint32 getCachedPageCount() const { return _cachedPageCount; }
+	const CacheStats &getCacheStats() const { return _cacheStats; }
+
 	int   getFrameCount(int animation) const { return _animations[animation].frameCount; }
 	float getFPS(int animation) const { return _animations[animation].fps; }
 
 	Vector3 getPositionChange(int animation) const;
 	float   getFacingChange(int animation) const;
+
+private:
+	bool loadPage(uint32 page);
+	void touchPage(uint32 page);
+	void unlinkPage(uint32 page);
+	void evictPages(int32 keepPage);
 };
 
 } // End of namespace BladeRunner
@@ -538,6 +538,16 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	}
 }
 
+template<typename PixelType>
+static inline void drawSliceSpan(PixelType *dst, uint16 *zbuffer, int count, int z, uint32 color) {
+	for (int x = 0; x < count; ++x) {
+		if (z < zbuffer[x]) {
+			zbuffer[x] = (uint16)z;
+			dst[x] = (PixelType)color;
+		}
+	}
+}
+
 void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine) {
 	if (slice < 0 || (uint32)slice >= _frameSliceCount) {
 		return;
@@ -554,6 +564,10 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
 
+	// Spans end at x <= 640 at most, so on a full width surface all pixels of a span are in this line
+	byte *linePtr = (byte *)surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+	bool spanFitsLine = surface.w >= 640;
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -587,12 +601,30 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufferLine[x]) {
-							zbufferLine[x] = (uint16)vertexZ;
-
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
+					if (spanFitsLine) {
+						int count = vertexX - previousVertexX;
+						uint16 *zbufferPtr = zbufferLine + previousVertexX;
+						switch (surface.format.bytesPerPixel) {
+						case 1:
+							drawSliceSpan((uint8 *)linePtr + previousVertexX, zbufferPtr, count, vertexZ, outColor);
+							break;
+						case 2:
+							drawSliceSpan((uint16 *)linePtr + previousVertexX, zbufferPtr, count, vertexZ, outColor);
+							break;
+						case 4:
+							drawSliceSpan((uint32 *)linePtr + previousVertexX, zbufferPtr, count, vertexZ, outColor);
+							break;
+						default:
+							break;
+						}
+					} else {
+						for (int x = previousVertexX; x != vertexX; ++x) {
+							if (vertexZ < zbufferLine[x]) {
+								zbufferLine[x] = (uint16)vertexZ;
+
+								void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
+								drawPixel(surface, dstPtr, outColor);
+							}
 						}
 					}
 				}
@@ -745,10 +777,7 @@ void SliceRenderer::drawShadowPolygon(int transparency, Graphics::Surface &surfa
 }
 
 void SliceRenderer::preload(int animationId) {
-	int frameCount = _vm->_sliceAnimations->getFrameCount(animationId);
-	for (int i = 0; i < frameCount; ++i) {
-		_vm->_sliceAnimations->getFramePtr(animationId, i);
-	}
+	_vm->_sliceAnimations->preload(animationId);
 }
 
 void SliceRenderer::disableShadows(int animationsIdsList[], int listSize) {
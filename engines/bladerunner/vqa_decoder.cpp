@@ -142,6 +142,7 @@ VQADecoder::VQADecoder() {
 VQADecoder::~VQADecoder() {
 	for (uint i = 0; i < _codebooks.size(); ++i) {
 		delete[] _codebooks[i].data;
+		delete[] _codebooks[i].colors;
 	}
 	delete _audioTrack;
 	delete _videoTrack;
@@ -467,6 +468,7 @@ bool VQADecoder::readCINF(Common::SeekableReadStream *s, uint32 size) {
 		_codebooks[i].frame = s->readUint16LE();
 		_codebooks[i].size  = s->readUint32LE();
 		_codebooks[i].data  = nullptr;
+		_codebooks[i].colors = nullptr;
 
 		// debug("Codebook %2d: %4d %8d", i, _codebooks[i].frame, _codebooks[i].size);
 
@@ -595,8 +597,9 @@ VQADecoder::VQAVideoTrack::VQAVideoTrack(VQADecoder *vqaDecoder) {
 	_maxCBFZSize = header->maxCBFZSize;
 	_maxZBUFChunkSize = vqaDecoder->_maxZBUFChunkSize;
 
-	_codebook = nullptr;
-	_cbfz     = nullptr;
+	_codebook       = nullptr;
+	_codebookColors = nullptr;
+	_cbfz           = nullptr;
 
 	_vpointerSize = 0;
 	_vpointer = nullptr;
@@ -817,7 +820,69 @@ bool VQADecoder::VQAVideoTrack::readVPTR(Common::SeekableReadStream *s, uint32 s
 	return true;
 }
 
+uint32 *VQADecoder::VQAVideoTrack::convertCodebook(const uint8 *codebook) {
+	Graphics::PixelFormat format = screenPixelFormat();
+	uint32 colorCount = _maxBlocks * _blockW * _blockH;
+	uint32 *colors = new uint32[colorCount];
+
+	for (uint32 i = 0; i < colorCount; ++i) {
+		uint8 a, r, g, b;
+		getGameDataColor(READ_LE_UINT16(codebook + 2 * i), a, r, g, b);
+		colors[i] = format.RGBToColor(r, g, b);
+	}
+
+	return colors;
+}
+
+template<typename PixelType>
+void VQADecoder::VQAVideoTrack::VPTRWriteBlockFast(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha) {
+	const uint32 *const block_colors = &_codebookColors[srcBlock * _blockW * _blockH];
+	const uint8 *const block_src = &_codebook[2 * srcBlock * _blockW * _blockH];
+
+	int blocks_per_line = _width / _blockW;
+
+	for (int i = 0; i < count; ++i) {
+		uint32 dst_x = (dstBlock + i) % blocks_per_line * _blockW + _offsetX;
+		uint32 dst_y = (dstBlock + i) / blocks_per_line * _blockH + _offsetY;
+
+		const uint32 *colors_p = block_colors;
+		const uint8 *src_p = block_src;
+
+		for (int y = 0; y != _blockH; ++y) {
+			PixelType *dst_p = (PixelType *)surface->getBasePtr(dst_x, dst_y + y);
+
+			if (!alpha) {
+				for (int x = 0; x != _blockW; ++x) {
+					dst_p[x] = (PixelType)colors_p[x];
+				}
+			} else {
+				for (int x = 0; x != _blockW; ++x) {
+					// Pixels with the alpha bit set are transparent
+					if (!(src_p[2 * x + 1] & 0x80)) {
+						dst_p[x] = (PixelType)colors_p[x];
+					}
+				}
+			}
+			colors_p += _blockW;
+			src_p += 2 * _blockW;
+		}
+	}
+}
+
 void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha) {
+	if (_codebookColors && surface->format == screenPixelFormat()) {
+		switch (surface->format.bytesPerPixel) {
+		case 2:
+			VPTRWriteBlockFast<uint16>(surface, dstBlock, srcBlock, count, alpha);
+			return;
+		case 4:
+			VPTRWriteBlockFast<uint32>(surface, dstBlock, srcBlock, count, alpha);
+			return;
+		default:
+			break;
+		}
+	}
+
 	const uint8 *const block_src = &_codebook[2 * srcBlock * _blockW * _blockH];
 
 	int blocks_per_line = _width / _blockW;
@@ -859,6 +924,12 @@ bool VQADecoder::VQAVideoTrack::decodeFrame(Graphics::Surface *surface) {
 	if (!_codebook || !_vpointer)
 		return false;
 
+	// Converting the codebook once is much cheaper than converting every pixel of every frame
+	if (!codebookInfo.colors) {
+		codebookInfo.colors = convertCodebook(_codebook);
+	}
+	_codebookColors = codebookInfo.colors;
+
 	uint8 *src = _vpointer;
 	uint8 *end = _vpointer + _vpointerSize;
 
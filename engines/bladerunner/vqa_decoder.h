@@ -133,6 +133,7 @@ public:
 		uint16  frame;
 		uint32  size;
 		uint8  *data;
+		uint32 *colors; // data converted to the screen pixel format
 	};
 
 	class VQAVideoTrack;
@@ -216,6 +217,7 @@ public:
 		uint32  _maxZBUFChunkSize;
 
 		uint8   *_codebook;
+		uint32  *_codebookColors;
 		uint8   *_cbfz;
 		uint32   _zbufChunkSize;
 		uint8   *_zbufChunk;
@@ -233,6 +235,9 @@ public:
 		uint32   _screenEffectsDataSize;
 
 		void VPTRWriteBlock(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha = false);
+		template<typename PixelType>
+		void VPTRWriteBlockFast(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha);
+		uint32 *convertCodebook(const uint8 *codebook);
 		bool decodeFrame(Graphics::Surface *surface);
 	};
 
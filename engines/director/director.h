@@ -230,7 +230,7 @@ public:
 	Archive *createArchive();
 
 	// events.cpp
-	void processEvents();
+	void processEvents(bool wait = true);
 	uint32 getMacTicks();
 
 public:
@@ -56,7 +56,7 @@ bool processQuitEvent(bool click) {
 
 uint32 DirectorEngine::getMacTicks() { return g_system->getMillis() * 60 / 1000.; }
 
-void DirectorEngine::processEvents() {
+void DirectorEngine::processEvents(bool wait) {
 	debugC(3, kDebugEvents, "\n@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@");
 	debugC(3, kDebugEvents, "@@@@   Processing events");
 	debugC(3, kDebugEvents, "@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@\n");
@@ -81,6 +81,9 @@ void DirectorEngine::processEvents() {
 			}
 		}
 
+		if (!wait)
+			break;
+
 		g_system->delayMillis(10);
 	}
 }
@@ -182,7 +182,7 @@ void Lingo::cleanupFuncs() {
 		delete it->_value;
 }
 
-void Lingo::push(Datum d) {
+void Lingo::push(const Datum &d) {
 	_stack.push_back(d);
 }
 
@@ -618,6 +618,9 @@ Datum LC::mapBinaryOp(Datum (*mapFunc)(Datum &, Datum &), Datum &d1, Datum &d2)
 }
 
 Datum LC::addData(Datum &d1, Datum &d2) {
+	if (d1.type == INT && d2.type == INT)
+		return Datum(d1.u.i + d2.u.i);
+
 	if (d1.type == ARRAY || d2.type == ARRAY) {
 		return LC::mapBinaryOp(LC::addData, d1, d2);
 	}
@@ -642,6 +645,9 @@ void LC::c_add() {
 }
 
 Datum LC::subData(Datum &d1, Datum &d2) {
+	if (d1.type == INT && d2.type == INT)
+		return Datum(d1.u.i - d2.u.i);
+
 	if (d1.type == ARRAY || d2.type == ARRAY) {
 		return LC::mapBinaryOp(LC::subData, d1, d2);
 	}
@@ -666,6 +672,9 @@ void LC::c_sub() {
 }
 
 Datum LC::mulData(Datum &d1, Datum &d2) {
+	if (d1.type == INT && d2.type == INT)
+		return Datum(d1.u.i * d2.u.i);
+
 	if (d1.type == ARRAY || d2.type == ARRAY) {
 		return LC::mapBinaryOp(LC::mulData, d1, d2);
 	}
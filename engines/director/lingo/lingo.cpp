@@ -22,6 +22,7 @@
 
 #include "common/file.h"
 #include "common/config-manager.h"
+#include "common/system.h"
 
 #include "graphics/macgui/macwindowmanager.h"
 
@@ -577,6 +578,7 @@ Common::String Lingo::decodeInstruction(LingoArchive *archive, ScriptData *sd, u
 
 void Lingo::execute(uint pc) {
 	uint localCounter = 0;
+	uint32 lastEventPoll = g_system->getMillis();
 
 	for (_pc = pc; !_abort && (*_currentScript)[_pc] != STOP;) {
 		if (_globalCounter > 1000 && debugChannelSet(-1, kDebugFewFramesOnly)) {
@@ -585,7 +587,6 @@ void Lingo::execute(uint pc) {
 			break;
 		}
 	
-		Common::String instr = decodeInstruction(_currentArchive, _currentScript, _pc);
 		uint current = _pc;
 
 		if (debugChannelSet(5, kDebugLingoExec))
@@ -598,7 +599,9 @@ void Lingo::execute(uint pc) {
 				debug("me: %s", _currentMe.asString(true).c_str());
 		}
 
-		debugC(1, kDebugLingoExec, "[%3d]: %s", current, instr.c_str());
+		// Decoding is only needed for the trace, and costs more than most opcodes
+		if (debugChannelSet(1, kDebugLingoExec))
+			debugC(1, kDebugLingoExec, "[%3d]: %s", current, decodeInstruction(_currentArchive, _currentScript, current).c_str());
 
 		_pc++;
 		(*((*_currentScript)[_pc - 1]))();
@@ -619,9 +622,11 @@ void Lingo::execute(uint pc) {
 		_globalCounter++;
 		localCounter++;
 
-		// process events every so often
-		if (localCounter % 100 == 0) {
-			_vm->processEvents();
+		// Process events every so often. Only poll them, waiting for the
+		// next frame here would throttle long running scripts.
+		if (localCounter % 100 == 0 && g_system->getMillis() - lastEventPoll >= 10) {
+			_vm->processEvents(false);
+			lastEventPoll = g_system->getMillis();
 			if (_vm->getCurrentMovie()->getScore()->_playState == kPlayStopped)
 				break;
 		}
@@ -747,43 +752,72 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool numsOnly) {
 	return opType;
 }
 
+static bool ownsPayload(int type) {
+	switch (type) {
+	case VAR:
+	case STRING:
+	case ARRAY:
+	case POINT:
+	case RECT:
+	case PARRAY:
+	case OBJECT:
+	case CHUNKREF:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Datums without a reference count are the sole owners of their payload.
+// Numbers, the bulk of what goes through the stack, never get one, so
+// pushing and popping them does not touch the heap. Datums built by
+// filling in a default constructed one get a count the first time they
+// are copied.
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 }
 
 Datum::Datum(const Datum &d) {
 	type = d.type;
 	u = d.u;
-	refCount = d.refCount;
-	*refCount += 1;
+	refCount = d.shareRefCount();
 }
 
 Datum& Datum::operator=(const Datum &d) {
-	if (this != &d && refCount != d.refCount) {
+	if (this != &d && (!refCount || refCount != d.refCount)) {
 		reset();
 		type = d.type;
 		u = d.u;
-		refCount = d.refCount;
-		*refCount += 1;
+		refCount = d.shareRefCount();
 	}
 	return *this;
 }
 
+int *Datum::shareRefCount() const {
+	if (!refCount) {
+		if (!ownsPayload(type))
+			return nullptr;
+
+		refCount = new int;
+		*refCount = 1;
+	}
+
+	*refCount += 1;
+	return refCount;
+}
+
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 }
 
 Datum::Datum(const Common::String &val) {
@@ -801,21 +835,21 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 }
 
 void Datum::reset() {
-	if (!refCount)
+	if (refCount)
+		*refCount -= 1;
+	else if (!ownsPayload(type))
 		return;
 
-	*refCount -= 1;
 	// Coverity thinks that we always free memory, as it assumes
 	// (correctly) that there are cases when refCount == 0
 	// Thus, DO NOT COMPILE, trick it and shut tons of false positives
 #ifndef __COVERITY__
-	if (*refCount <= 0) {
+	if (!refCount || *refCount <= 0) {
 		switch (type) {
 		case VAR:
 		case STRING:
@@ -844,7 +878,7 @@ void Datum::reset() {
 		default:
 			break;
 		}
-		if (type != OBJECT) // object owns refCount
+		if (refCount && type != OBJECT) // object owns refCount
 			delete refCount;
 	}
 #endif
@@ -1328,23 +1362,26 @@ Datum Lingo::varFetch(Datum &var, bool global, DatumHash *localvars, bool silent
 	Datum result;
 
 	if (var.type == VAR) {
-		Datum d;
-		Common::String name = *var.u.s;
-
-		if (localvars && localvars->contains(name)) {
-			if (global)
-				warning("varFetch: variable %s is local, not global", name.c_str());
-			return (*localvars)[name];
+		const Common::String &name = *var.u.s;
+
+		if (localvars) {
+			DatumHash::iterator it = localvars->find(name);
+			if (it != localvars->end()) {
+				if (global)
+					warning("varFetch: variable %s is local, not global", name.c_str());
+				return it->_value;
+			}
 		}
 		if (_currentMe.type == OBJECT && _currentMe.u.obj->hasProp(name)) {
 			if (global)
 				warning("varFetch: variable %s is instance or property, not global", name.c_str());
 			return _currentMe.u.obj->getProp(name);
 		}
-		if (_globalvars.contains(name)) {
+		DatumHash::iterator it = _globalvars.find(name);
+		if (it != _globalvars.end()) {
 			if (!global)
 				warning("varFetch: variable %s is global, not local", name.c_str());
-			return _globalvars[name];
+			return it->_value;
 		}
 
 		if (!silent)
@@ -121,7 +121,7 @@ struct Datum {	/* interpreter stack type */
 		ChunkReference *cref; /* CHUNKREF */
 	} u;
 
-	int *refCount;
+	mutable int *refCount;
 
 	Datum();
 	Datum(const Datum &d);
@@ -131,6 +131,7 @@ struct Datum {	/* interpreter stack type */
 	Datum(const Common::String &val);
 	Datum(AbstractObject *val);
 	void reset();
+	int *shareRefCount() const;
 
 	~Datum() {
 		reset();
@@ -448,7 +449,7 @@ private:
 	void parseMenu(const char *code);
 
 public:
-	void push(Datum d);
+	void push(const Datum &d);
 	Datum pop(bool eval = true);
 	Datum peek(uint offset, bool eval = true);
 
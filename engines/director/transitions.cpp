@@ -554,6 +554,91 @@ static uint32 randomSeed[33] = {
 	0x14000000UL, 0x32800000UL, 0x48000000UL, 0xa3000000UL
 };
 
+// Total number of cells kept in cached dissolve orders (16MB). A stage-wide
+// bit dissolve on a 640x480 stage alone takes 2.4M cells.
+static const uint32 kMaxDissolveOrderCells = 4 * 1024 * 1024;
+
+// Sleep until the given step of a transition started at startTime is due.
+// Steps which took longer than their share are not waited for, so that
+// slow machines catch up instead of running past the transition duration.
+static void waitForStep(uint32 startTime, int step, int stepDuration) {
+	int32 delay = (int32)(startTime + step * stepDuration - g_system->getMillis());
+
+	if (delay > 0)
+		g_system->delayMillis(delay);
+}
+
+const DissolveOrder &Window::getDissolveOrder(uint w, uint h) {
+	uint32 key = (w << 16) | h;
+
+	if (_dissolveOrders.contains(key))
+		return _dissolveOrders[key];
+
+	// The LFSR visits every cell of the grid exactly once
+	const uint32 numCells = w * h;
+
+	DissolveOrder *orderPtr;
+	if (numCells > kMaxDissolveOrderCells) {
+		orderPtr = &_uncachedDissolveOrder;
+	} else {
+		if (_dissolveOrderCells + numCells > kMaxDissolveOrderCells) {
+			_dissolveOrders.clear();
+			_dissolveOrderCells = 0;
+		}
+		orderPtr = &_dissolveOrders[key];
+		_dissolveOrderCells += numCells;
+	}
+
+	DissolveOrder &order = *orderPtr;
+	order.cells.clear();
+	order.stepEnds.clear();
+	order.cells.reserve(numCells);
+
+	int vBits = getLog2(w);
+	int hBits = getLog2(h);
+	uint32 rnd, seed;
+
+	rnd = seed = randomSeed[hBits + vBits];
+	int hMask = (1L << hBits) - 1;
+	int vShift = hBits;
+
+	uint32 pixPerStepInit = 1;
+	int steps = (1 << (hBits + vBits)) - 1;
+
+	while (steps > 64) {
+		pixPerStepInit <<= 1;
+		steps >>= 1;
+	}
+	steps++;
+
+	// Once the sequence is back at its seed, all cells have been revealed and
+	// any remaining steps are empty
+	bool done = false;
+
+	for (int i = 0; i < steps; i++) {
+		uint32 pixPerStep = pixPerStepInit;
+		while (!done) {
+			uint32 x = (rnd - 1) >> vShift;
+			uint32 y = (rnd - 1) & hMask;
+
+			if (x < w && y < h)
+				order.cells.push_back((x << 16) | y);
+
+			rnd = (rnd & 1) ? (rnd >> 1) ^ seed : rnd >> 1;
+			done = (rnd == seed);
+
+			if (--pixPerStep == 0)
+				break;
+		}
+
+		order.stepEnds.push_back(order.cells.size());
+	}
+
+	debugC(2, kDebugImages, "Window::getDissolveOrder(): %dx%d grid, %d cells in %d steps", w, h, order.cells.size(), steps);
+
+	return order;
+}
+
 void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::ManagedSurface *nextFrame) {
 	uint w = clipRect.width();
 	uint h = clipRect.height();
@@ -629,81 +714,57 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 		break;
 	}
 
-	int vBits = getLog2(w);
-	int hBits = getLog2(h);
-	uint32 rnd, seed;
-
-	if (hBits <= 0 || vBits <= 0)
+	if (getLog2(w) <= 0 || getLog2(h) <= 0)
 		return;
 
-	rnd = seed = randomSeed[hBits + vBits];
-	int hMask = (1L << hBits) - 1;
-	int vShift = hBits;
-
-	// Calculate steps
-	uint32 pixPerStepInit = 1;
-	t.steps = (1 << (hBits + vBits)) - 1;
-
-	while (t.steps > 64) {
-		pixPerStepInit <<= 1;
-		t.steps >>= 1;
-	}
-	t.steps++;
+	// The reveal order only depends on the grid, so it is worked out once
+	// and then replayed as plain copies
+	const DissolveOrder &order = getDissolveOrder(w, h);
 
+	t.steps = order.stepEnds.size();
 	t.stepDuration = t.duration / t.steps;
 
 	if (t.type == kTransDissolvePixelsFast ||
 			t.type == kTransDissolveBitsFast)
 		t.stepDuration = 0;						// No delay
 
-	Common::Rect r(MAX(1, t.xStepSize), t.yStepSize);
+	Common::Rect r;
+	uint32 startTime = g_system->getMillis();
+	uint c = 0;
 
 	for (int i = 0; i < t.steps; i++) {
-		uint32 pixPerStep = pixPerStepInit;
-		do {
-			uint32 x = (rnd - 1) >> vShift;
-			uint32 y = (rnd - 1) & hMask;
-			byte mask = 0;
-
-			r.setWidth(MAX(1, t.xStepSize));
-			r.setHeight(t.yStepSize);
-
-			if (x < w && y < h) {
-				if (t.xStepSize >= 1) {
-					x = x * t.xStepSize;
-					y = y * t.yStepSize;
+		for (; c < order.stepEnds[i]; c++) {
+			uint32 x = order.cells[c] >> 16;
+			uint32 y = order.cells[c] & 0xffff;
 
-					if (x < realw && y < realh) {
-						x += clipRect.left;
-						y += clipRect.top;
-						r.moveTo(x, y);
-						r.clip(clipRect);
-
-						if (!r.isEmpty())
-							_composeSurface->copyRectToSurface(*nextFrame, x, y, r);
-					}
-				} else {
-					mask = pixmask[x % -t.xStepSize];
-					x = x / -t.xStepSize;
+			if (t.xStepSize >= 1) {
+				x = x * t.xStepSize;
+				y = y * t.yStepSize;
 
+				if (x < realw && y < realh) {
 					x += clipRect.left;
 					y += clipRect.top;
+					r.setWidth(MAX(1, t.xStepSize));
+					r.setHeight(t.yStepSize);
+					r.moveTo(x, y);
+					r.clip(clipRect);
 
-					byte *dst = (byte *)_composeSurface->getBasePtr(x, y);
-					byte *src = (byte *)nextFrame->getBasePtr(x, y);
-
-					*dst = ((*dst & ~mask) | (*src & mask)) & 0xff;
+					if (!r.isEmpty())
+						_composeSurface->copyRectToSurface(*nextFrame, x, y, r);
 				}
-			}
+			} else {
+				byte mask = pixmask[x % -t.xStepSize];
+				x = x / -t.xStepSize;
 
-			rnd = (rnd & 1) ? (rnd >> 1) ^ seed : rnd >> 1;
+				x += clipRect.left;
+				y += clipRect.top;
 
-			if (pixPerStep > 0) {
-				if (--pixPerStep == 0) {
-					break;
-				}
+				byte *dst = (byte *)_composeSurface->getBasePtr(x, y);
+				byte *src = (byte *)nextFrame->getBasePtr(x, y);
+
+				*dst = ((*dst & ~mask) | (*src & mask)) & 0xff;
 			}
-		} while (rnd != seed);
+		}
 
 		stepTransition();
 
@@ -714,7 +775,15 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 			break;
 		}
 
-		g_system->delayMillis(t.stepDuration);
+		waitForStep(startTime, i + 1, t.stepDuration);
+	}
+
+	debugC(2, kDebugImages, "Window::dissolveTrans(): %d steps took %d ms, %d ms requested",
+			t.steps, g_system->getMillis() - startTime, t.stepDuration * t.steps);
+
+	if (&order == &_uncachedDissolveOrder) {
+		_uncachedDissolveOrder.cells.clear();
+		_uncachedDissolveOrder.stepEnds.clear();
 	}
 }
 
@@ -828,6 +897,7 @@ void Window::transMultiPass(TransParams &t, Common::Rect &clipRect, Graphics::Ma
 	bool flag = false;
 
 	Common::Array<Common::Rect> rects;
+	uint32 startTime = g_system->getMillis();
 
 	for (uint16 i = 1; i < t.steps; i++) {
 		bool stop = false;
@@ -971,6 +1041,9 @@ void Window::transMultiPass(TransParams &t, Common::Rect &clipRect, Graphics::Ma
 		if (stop)
 			break;
 
+		// Blit all the pieces of this step, then update the screen once
+		bool changed = false;
+
 		for (uint r = 0; r < rects.size(); r++) {
 			rto = rects[r];
 			rto.translate(clipRect.left, clipRect.top);
@@ -978,14 +1051,17 @@ void Window::transMultiPass(TransParams &t, Common::Rect &clipRect, Graphics::Ma
 
 			if (rto.height() > 0 && rto.width() > 0) {
 				_composeSurface->blitFrom(*nextFrame, rto, Common::Point(rto.left, rto.top));
-				stepTransition();
+				changed = true;
 			}
 		}
 		rects.clear();
 
+		if (changed)
+			stepTransition();
+
 		g_lingo->executePerFrameHook(t.frame, i);
 
-		g_system->delayMillis(t.stepDuration);
+		waitForStep(startTime, i, t.stepDuration);
 
 		if (processQuitEvent(true)) {
 			exitTransition(nextFrame, clipRect);
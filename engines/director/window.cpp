@@ -59,6 +59,9 @@ Window::Window(int id, bool scrollable, bool resizable, bool editable, Graphics:
 
 	_windowType = -1;
 	_titleVisible = true;
+	_blitPixels = 0;
+	_spanBlitPixels = 0;
+	_dissolveOrderCells = 0;
 	updateBorderType();
 }
 
@@ -114,6 +117,10 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	if (!blitTo)
 		blitTo = _composeSurface;
 
+	_blitPixels = 0;
+	_spanBlitPixels = 0;
+	uint numRects = _dirtyRects.size();
+
 	for (Common::List<Common::Rect>::iterator i = _dirtyRects.begin(); i != _dirtyRects.end(); i++) {
 		const Common::Rect &r = *i;
 		blitTo->fillRect(r, _stageColor);
@@ -135,6 +142,9 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 		}
 	}
 
+	debugC(5, kDebugImages, "Window::render(): %d dirty rects, %d pixels blitted, %d of them as spans",
+			numRects, _blitPixels, _spanBlitPixels);
+
 	_dirtyRects.clear();
 	_contentIsDirty = true;
 
@@ -241,6 +251,88 @@ void Window::inkBlitShape(DirectorPlotData *pd, Common::Rect &srcRect) {
 	}
 }
 
+template<typename T>
+static void inkBlitSpan(T *dst, const T *src, const T *msk, int count, const DirectorPlotData *pd) {
+	for (int j = 0; j < count; j++, dst++, src++) {
+		if (msk) {
+			bool visible = (pd->ink == kInkTypeMask) ? *msk != 0 : *msk == 0;
+			msk++;
+			if (!visible)
+				continue;
+		}
+
+		switch (pd->ink) {
+		case kInkTypeBackgndTrans:
+			if (*src != (T)pd->backColor)
+				*dst = *src;
+			break;
+		case kInkTypeTransparent:
+			*dst &= *src;
+			break;
+		case kInkTypeNotTrans:
+			*dst &= ~*src;
+			break;
+		case kInkTypeReverse:
+			*dst ^= ~*src;
+			break;
+		case kInkTypeNotReverse:
+			*dst ^= *src;
+			break;
+		case kInkTypeGhost:
+			*dst |= ~*src;
+			break;
+		case kInkTypeNotGhost:
+			*dst |= *src;
+			break;
+		default:
+			*dst = *src;
+			break;
+		}
+	}
+}
+
+bool Window::inkBlitSpans(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask) {
+	// Spans handle the inks which, without colourization, are plain bitwise
+	// operations. Blending and the arithmetic inks need palette lookups and
+	// go through inkDrawPixel.
+	if (pd->ms || pd->alpha || pd->applyColor || pd->sprite == kTextSprite)
+		return false;
+
+	switch (pd->ink) {
+	case kInkTypeCopy:
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeNotCopy:
+	case kInkTypeBackgndTrans:
+	case kInkTypeTransparent:
+	case kInkTypeNotTrans:
+	case kInkTypeReverse:
+	case kInkTypeNotReverse:
+	case kInkTypeGhost:
+	case kInkTypeNotGhost:
+		break;
+	default:
+		return false;
+	}
+
+	int srcX = abs(srcRect.left - pd->destRect.left);
+	int srcY = abs(srcRect.top - pd->destRect.top);
+	int width = pd->destRect.width();
+
+	for (int i = 0; i < pd->destRect.height(); i++, srcY++) {
+		void *dst = pd->dst->getBasePtr(pd->destRect.left, pd->destRect.top + i);
+		const void *src = pd->srf->getBasePtr(srcX, srcY);
+		const void *msk = mask ? mask->getBasePtr(srcX, srcY) : nullptr;
+
+		if (_wm->_pixelformat.bytesPerPixel == 1)
+			inkBlitSpan<byte>((byte *)dst, (const byte *)src, (const byte *)msk, width, pd);
+		else
+			inkBlitSpan<uint32>((uint32 *)dst, (const uint32 *)src, (const uint32 *)msk, width, pd);
+	}
+
+	return true;
+}
+
 void Window::inkBlitSurface(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!pd->srf)
 		return;
@@ -249,6 +341,14 @@ void Window::inkBlitSurface(DirectorPlotData *pd, Common::Rect &srcRect, const G
 	if (pd->sprite == kTextSprite)
 		pd->applyColor = false;
 
+	uint32 pixels = pd->destRect.width() * pd->destRect.height();
+	_blitPixels += pixels;
+
+	if (inkBlitSpans(pd, srcRect, mask)) {
+		_spanBlitPixels += pixels;
+		return;
+	}
+
 	pd->srcPoint.y = abs(srcRect.top - pd->destRect.top);
 	for (int i = 0; i < pd->destRect.height(); i++, pd->srcPoint.y++) {
 		if (_wm->_pixelformat.bytesPerPixel == 1) {
@@ -86,6 +86,14 @@ struct TransParams {
 	}
 };
 
+// Order in which dissolveTrans reveals the cells of a grid, as produced by
+// its LFSR. Cells outside the grid are dropped, stepEnds[i] is the index in
+// cells where step i stops.
+struct DissolveOrder {
+	Common::Array<uint32> cells;
+	Common::Array<uint32> stepEnds;
+};
+
 class Window : public Graphics::MacWindow, public Object<Window> {
  public:
 	Window(int id, bool scrollable, bool resizable, bool editable, Graphics::MacWindowManager *wm, DirectorEngine *vm, bool isStage);
@@ -109,6 +117,7 @@ class Window : public Graphics::MacWindow, public Object<Window> {
 	void dissolvePatternsTrans(TransParams &t, Common::Rect &clipRect, Graphics::ManagedSurface *tmpSurface);
 	void transMultiPass(TransParams &t, Common::Rect &clipRect, Graphics::ManagedSurface *tmpSurface);
 	void transZoom(TransParams &t, Common::Rect &clipRect, Graphics::ManagedSurface *tmpSurface);
+	const DissolveOrder &getDissolveOrder(uint w, uint h);
 
 	Common::Point getMousePos();
 
@@ -184,8 +193,20 @@ private:
 	int _windowType;
 	bool _titleVisible;
 
+	// Pixels blitted by the current render() call, and how many of them
+	// went through the span blitters
+	uint32 _blitPixels;
+	uint32 _spanBlitPixels;
+
+	// Dissolve orders keyed by grid size, see getDissolveOrder()
+	Common::HashMap<uint32, DissolveOrder> _dissolveOrders;
+	uint32 _dissolveOrderCells;
+	// Order for a grid too large to be cached, freed after the transition
+	DissolveOrder _uncachedDissolveOrder;
+
 private:
 	int preprocessColor(DirectorPlotData *p, uint32 src);
+	bool inkBlitSpans(DirectorPlotData *pd, Common::Rect &srcRect, const Graphics::Surface *mask);
 
 	void inkBlitFrom(Channel *channel, Common::Rect destRect, Graphics::ManagedSurface *blitTo = nullptr);
 	void inkBlitShape(DirectorPlotData *pd, Common::Rect &srcRect);
@@ -0,0 +1,209 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#include "glk/batch.h"
+#include "glk/glk.h"
+#include "glk/windows.h"
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/fs.h"
+#include "common/keyboard.h"
+#include "common/system.h"
+
+namespace Glk {
+
+#define MAX_MORE_PROMPTS 64
+
+BatchRun::BatchRun() : _scriptPos(0), _startTime(0), _commandStart(0), _commandChars(0),
+		_active(false), _finished(false) {
+	if (!ConfMan.hasKey("glk_batch_input"))
+		return;
+
+	if (!loadScript(ConfMan.get("glk_batch_input")))
+		return;
+
+	if (ConfMan.hasKey("glk_batch_output")) {
+		Common::String filename = ConfMan.get("glk_batch_output");
+		if (!_output.open(Common::FSNode(filename)))
+			warning("Could not create batch output file %s", filename.c_str());
+	}
+
+	_active = true;
+	_startTime = _commandStart = g_system->getMillis();
+	_command = "<startup>";
+}
+
+BatchRun::~BatchRun() {
+	flushOutput();
+	_output.close();
+}
+
+bool BatchRun::loadScript(const Common::String &filename) {
+	Common::File f;
+	if (!f.open(Common::FSNode(filename)) && !f.open(filename)) {
+		warning("Could not open batch input file %s", filename.c_str());
+		return false;
+	}
+
+	while (!f.eos()) {
+		Common::String line = f.readLine();
+		if (f.eos() && line.empty())
+			break;
+
+		_script.push_back(line);
+	}
+
+	debug("Batch run: loaded %u commands from %s", _script.size(), filename.c_str());
+	return true;
+}
+
+void BatchRun::flushOutput() {
+	if (_pending.empty())
+		return;
+
+	if (_output.isOpen()) {
+		Common::String text = _pending.encode();
+		_output.write(text.c_str(), text.size());
+	}
+
+	_pending.clear();
+}
+
+void BatchRun::endCommand() {
+	uint32 time = g_system->getMillis() - _commandStart;
+	_timings.push_back(CommandTiming(_command, time, _commandChars));
+	debug("Batch run: command %u \"%s\": %u ms, %u characters output",
+		_timings.size() - 1, _command.c_str(), time, _commandChars);
+
+	flushOutput();
+}
+
+void BatchRun::finish() {
+	if (_finished)
+		return;
+
+	_finished = true;
+	flushOutput();
+	_output.flush();
+
+	uint32 total = 0, worst = 0;
+	uint worstIdx = 0;
+	for (uint idx = 0; idx < _timings.size(); ++idx) {
+		total += _timings[idx]._time;
+		if (_timings[idx]._time > worst) {
+			worst = _timings[idx]._time;
+			worstIdx = idx;
+		}
+	}
+
+	debug("Batch run: %u commands processed in %u ms (%u ms elapsed)", _timings.size(), total,
+		g_system->getMillis() - _startTime);
+	if (!_timings.empty())
+		debug("Batch run: average %u ms per command, slowest was command %u \"%s\" at %u ms",
+			total / _timings.size(), worstIdx, _timings[worstIdx]._command.c_str(), worst);
+
+	g_vm->quitGame();
+}
+
+Window *BatchRun::getInputWindow() const {
+	Windows &windows = *g_vm->_windows;
+
+	// Nobody is going to read any [more] prompts, so page through them
+	for (int idx = 0; Windows::_moreFocus && idx < MAX_MORE_PROMPTS; ++idx) {
+		windows.inputHandleKey(keycode_End);
+		windows.redraw();
+	}
+
+	windows.inputGuessFocus();
+	Window *win = windows.getFocusWindow();
+	if (win && (win->_lineRequest || win->_lineRequestUni || win->_charRequest || win->_charRequestUni))
+		return win;
+
+	return nullptr;
+}
+
+bool BatchRun::feedInput() {
+	if (!_active || _finished)
+		return false;
+
+	Window *win = getInputWindow();
+	if (!win)
+		return false;
+
+	endCommand();
+	if (_scriptPos >= _script.size()) {
+		finish();
+		return false;
+	}
+
+	Windows &windows = *g_vm->_windows;
+	const Common::String &line = _script[_scriptPos++];
+
+	if (win->_charRequest || win->_charRequestUni) {
+		windows.inputHandleKey(line.empty() ? (uint)keycode_Return : (byte)line[0]);
+	} else {
+		// Echo the command into the transcript, so it reads the same as a played session
+		if (win->_type == wintype_TextBuffer) {
+			_pending += Common::U32String(line);
+			_pending += '\n';
+		}
+
+		for (uint idx = 0; idx < line.size(); ++idx)
+			windows.inputHandleKey((byte)line[idx]);
+		windows.inputHandleKey(keycode_Return);
+	}
+
+	_command = line;
+	_commandChars = 0;
+	_commandStart = g_system->getMillis();
+	return true;
+}
+
+uint BatchRun::getKeypress() {
+	if (_finished)
+		return 0;
+
+	endCommand();
+	if (_scriptPos >= _script.size()) {
+		finish();
+		return 0;
+	}
+
+	const Common::String &line = _script[_scriptPos++];
+	_command = line;
+	_commandChars = 0;
+	_commandStart = g_system->getMillis();
+
+	return line.empty() ? (uint)Common::KEYCODE_RETURN : (byte)line[0];
+}
+
+void BatchRun::capture(const Window *win, uint32 ch) {
+	if (win->_type != wintype_TextBuffer)
+		return;
+
+	++_commandChars;
+	if (_output.isOpen())
+		_pending += ch;
+}
+
+} // End of namespace Glk
@@ -0,0 +1,132 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#ifndef GLK_BATCH_H
+#define GLK_BATCH_H
+
+#include "glk/glk_types.h"
+#include "common/array.h"
+#include "common/file.h"
+#include "common/str-array.h"
+#include "common/ustr.h"
+
+namespace Glk {
+
+class Window;
+
+/**
+ * Headless batch runner. When the "glk_batch_input" configuration key names a text file,
+ * each of its lines is fed to the game as though it had been typed whenever the game waits
+ * for line or character input. Text sent to text buffer windows is written to the file named
+ * by "glk_batch_output" (if any), and the time the interpreter spent processing each command
+ * is reported, so that the same story and command script can be replayed to check for
+ * regressions or to measure interpreter throughput. The game quits once the script runs out.
+ */
+class BatchRun {
+	/**
+	 * Timing details of a single processed command
+	 */
+	struct CommandTiming {
+		Common::String _command;
+		uint32 _time;
+		uint32 _chars;
+
+		CommandTiming() : _time(0), _chars(0) {}
+		CommandTiming(const Common::String &command, uint32 time, uint32 chars) :
+			_command(command), _time(time), _chars(chars) {}
+	};
+private:
+	Common::StringArray _script;
+	uint _scriptPos;
+	Common::DumpFile _output;
+	Common::U32String _pending;
+	Common::Array<CommandTiming> _timings;
+	Common::String _command;
+	uint32 _startTime;
+	uint32 _commandStart;
+	uint32 _commandChars;
+	bool _active;
+	bool _finished;
+private:
+	/**
+	 * Loads the command script
+	 */
+	bool loadScript(const Common::String &filename);
+
+	/**
+	 * Writes out any captured text that hasn't yet been flushed
+	 */
+	void flushOutput();
+
+	/**
+	 * Records the timing of the command that has just finished processing
+	 */
+	void endCommand();
+
+	/**
+	 * Writes the timing summary, and quits the game
+	 */
+	void finish();
+
+	/**
+	 * Returns the window waiting for input, if any
+	 */
+	Window *getInputWindow() const;
+public:
+	/**
+	 * Constructor
+	 */
+	BatchRun();
+
+	/**
+	 * Destructor
+	 */
+	~BatchRun();
+
+	/**
+	 * Returns true if a batch run is in progress
+	 */
+	bool isActive() const {
+		return _active;
+	}
+
+	/**
+	 * Feeds the next scripted command into the window waiting for input.
+	 * @returns     True if input was provided
+	 */
+	bool feedInput();
+
+	/**
+	 * Returns the next scripted keypress, for sub-engines that wait for a key directly
+	 */
+	uint getKeypress();
+
+	/**
+	 * Captures a character written to a window
+	 */
+	void capture(const Window *win, uint32 ch);
+};
+
+} // End of namespace Glk
+
+#endif
@@ -21,6 +21,7 @@
  */
 
 #include "glk/events.h"
+#include "glk/batch.h"
 #include "glk/conf.h"
 #include "glk/glk.h"
 #include "glk/screen.h"
@@ -109,7 +110,12 @@ void Events::checkForNextFrameCounter() {
 		if (_redraw)
 			g_vm->_windows->redraw();
 		_redraw = false;
-		g_vm->_screen->update();
+
+		// Nobody watches a batch run, so the screen is never shown
+		if (g_vm->_batch->isActive())
+			g_vm->_screen->clearDirtyRects();
+		else
+			g_vm->_screen->update();
 
 		// Poll for any finished sounds
 		g_vm->_sounds->poll();
@@ -124,8 +130,11 @@ void Events::getEvent(event_t *event, bool polled) {
 
 	if (!polled) {
 		while (!g_vm->shouldQuit() && _currentEvent->type == evtype_None && !isTimerExpired()) {
-			pollEvents();
-			g_system->delayMillis(10);
+			// In a batch run, scripted input is supplied straight away without waiting
+			if (!g_vm->_batch->feedInput()) {
+				pollEvents();
+				g_system->delayMillis(10);
+			}
 
 			dispatchEvent(*_currentEvent, polled);
 		}
@@ -382,6 +391,9 @@ bool Events::isModifierKey(const Common::KeyCode &keycode) const {
 uint Events::getKeypress() {
 	Common::Event e;
 
+	if (g_vm->_batch->isActive())
+		return g_vm->_batch->getKeypress();
+
 	while (!g_vm->shouldQuit()) {
 		g_system->getEventManager()->pollEvent(e);
 		g_system->delayMillis(10);
@@ -30,6 +30,7 @@
 #include "graphics/scaler.h"
 #include "graphics/thumbnail.h"
 #include "glk/glk.h"
+#include "glk/batch.h"
 #include "glk/blorb.h"
 #include "glk/conf.h"
 #include "glk/debugger.h"
@@ -47,7 +48,7 @@ namespace Glk {
 GlkEngine *g_vm;
 
 GlkEngine::GlkEngine(OSystem *syst, const GlkGameDescription &gameDesc) :
-		_gameDescription(gameDesc), Engine(syst), _random("Glk"), _quitFlag(false), _blorb(nullptr),
+		_gameDescription(gameDesc), Engine(syst), _random("Glk"), _quitFlag(false), _batch(nullptr), _blorb(nullptr),
 		_clipboard(nullptr), _conf(nullptr),_events(nullptr), _pictures(nullptr), _screen(nullptr),
 		_selection(nullptr), _sounds(nullptr), _streams(nullptr), _windows(nullptr),
 		_copySelect(false), _terminated(false), _pcSpeaker(nullptr), _loadSaveSlot(-1),
@@ -64,6 +65,7 @@ GlkEngine::GlkEngine(OSystem *syst, const GlkGameDescription &gameDesc) :
 }
 
 GlkEngine::~GlkEngine() {
+	delete _batch;
 	delete _blorb;
 	delete _clipboard;
 	delete _events;
@@ -98,6 +100,7 @@ void GlkEngine::initialize() {
 	_sounds = new Sounds();
 	_streams = new Streams();
 	_windows = new Windows(_screen);
+	_batch = new BatchRun();
 
 	// Setup mixer
 	syncSoundSettings();
@@ -36,6 +36,7 @@
 
 namespace Glk {
 
+class BatchRun;
 class Clipboard;
 class Blorb;
 class Conf;
@@ -114,6 +115,7 @@ protected:
 	 */
 	void switchToWhiteOnBlack();
 public:
+	BatchRun *_batch;
 	Blorb *_blorb;
 	Clipboard *_clipboard;
 	Conf *_conf;
@@ -146,6 +146,11 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Direct-mapped cache of instructions in ROM, indexed by their address.
+	 */
+	decodedinst_t *decode_cache;
+
 	/**@}*/
 
 	/**
@@ -552,6 +557,23 @@ public:
 	*/
 	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
 
+	/**
+	 * Parse the opcode and operand modes of the instruction at addr into a decode cache entry.
+	 * The address must be in ROM, since the entry is reused every time the instruction is executed.
+	 */
+	void decode_instruction(decodedinst_t *entry, uint addr);
+
+	/**
+	 * Load the operand values of an instruction that has been decoded by decode_instruction().
+	 * This is the equivalent of parse_operands(), except that it doesn't move the PC.
+	 */
+	void parse_decoded_operands(oparg_t *opargs, const decodedinst_t *entry);
+
+	/**
+	 * Empty the decoded instruction cache.
+	 */
+	void clear_decode_cache();
+
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
 	 * the result of an opcode, but it's also used by any code that pulls a call-stub off the stack.
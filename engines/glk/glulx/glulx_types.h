@@ -352,6 +352,38 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * Number of entries in the decoded instruction cache. Must be a power of two.
+ */
+#define DECODE_CACHE_SIZE (4096)
+
+/**
+ * How an operand of a decoded instruction gets its value. For store operands
+ * these are the same as the desttype values used by store_operand().
+ */
+enum decodedmode {
+	decodedmode_Const = 0,  ///< Load: constant value. Store: discard the value
+	decodedmode_Mem = 1,    ///< Main memory address
+	decodedmode_Local = 2,  ///< Offset in the current locals segment
+	decodedmode_Stack = 3   ///< Load: pop off the stack. Store: push on the stack
+};
+
+/**
+ * An instruction from the read-only part of main memory, with its opcode
+ * and operand modes already parsed. Since ROM never changes, only the values
+ * loaded from memory, locals and the stack have to be fetched again each time
+ * the instruction is executed.
+ */
+struct decodedinst_struct {
+	uint addr;                      ///< Address of the instruction, or 0xFFFFFFFF if unused
+	uint opcode;
+	uint nextpc;                    ///< Address of the following instruction
+	const operandlist_t *oplist;
+	byte modes[MAX_OPERANDS];       ///< One of the decodedmode values per operand
+	uint operands[MAX_OPERANDS];    ///< Constant value, or address, per operand
+};
+typedef decodedinst_struct decodedinst_t;
+
 typedef uint(Glulx::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
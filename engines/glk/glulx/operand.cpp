@@ -517,6 +517,204 @@ WrLocalsAddr:
 	}
 }
 
+void Glulx::clear_decode_cache() {
+	for (int ix = 0; ix < DECODE_CACHE_SIZE; ix++)
+		decode_cache[ix].addr = 0xFFFFFFFF;
+}
+
+void Glulx::decode_instruction(decodedinst_t *entry, uint addr) {
+	uint opcode;
+	const operandlist_t *oplist;
+	uint startaddr = addr;
+
+	/* Fetch the opcode number, as in execute_loop(). */
+	opcode = Mem1(addr);
+	addr++;
+	if (opcode & 0x80) {
+		if (opcode & 0x40) {
+			opcode &= 0x3F;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+		} else {
+			opcode &= 0x7F;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+		}
+	}
+
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		fatal_error_i("Encountered unknown opcode.", opcode);
+
+	/* Walk the operand modes the same way parse_operands() does, but
+	   only record where each value comes from. */
+	int numops = oplist->num_ops;
+	uint modeaddr = addr;
+	int modeval = 0;
+
+	addr += (numops + 1) / 2;
+
+	for (int ix = 0; ix < numops; ix++) {
+		int mode;
+		byte kind;
+		uint value = 0;
+
+		if ((ix & 1) == 0) {
+			modeval = Mem1(modeaddr);
+			mode = (modeval & 0x0F);
+		} else {
+			mode = ((modeval >> 4) & 0x0F);
+			modeaddr++;
+		}
+
+		switch (mode) {
+		case 0: /* constant zero, or discard value */
+			kind = decodedmode_Const;
+			break;
+
+		case 1: /* one-byte constant */
+		case 2: /* two-byte constant */
+		case 3: /* four-byte constant */
+			if (oplist->formlist[ix] != modeform_Load)
+				fatal_error("Constant addressing mode in store operand.");
+			kind = decodedmode_Const;
+			if (mode == 1) {
+				value = (int)(signed char)(Mem1(addr));
+				addr++;
+			} else if (mode == 2) {
+				value = (int)(signed char)(Mem1(addr));
+				value = (value << 8) | (uint)(Mem1(addr + 1));
+				addr += 2;
+			} else {
+				value = Mem4(addr);
+				addr += 4;
+			}
+			break;
+
+		case 8: /* stack */
+			kind = decodedmode_Stack;
+			break;
+
+		case 5: /* main memory */
+		case 6:
+		case 7:
+		case 13: /* main memory RAM */
+		case 14:
+		case 15:
+			kind = decodedmode_Mem;
+			if ((mode & 3) == 1) {
+				value = (uint)(Mem1(addr));
+				addr++;
+			} else if ((mode & 3) == 2) {
+				value = (uint)Mem2(addr);
+				addr += 2;
+			} else {
+				value = Mem4(addr);
+				addr += 4;
+			}
+			if (mode >= 13)
+				value += ramstart;
+			break;
+
+		case 9: /* locals */
+		case 10:
+		case 11:
+			kind = decodedmode_Local;
+			if (mode == 9) {
+				value = (uint)(Mem1(addr));
+				addr++;
+			} else if (mode == 10) {
+				value = (uint)Mem2(addr);
+				addr += 2;
+			} else {
+				value = Mem4(addr);
+				addr += 4;
+			}
+			break;
+
+		default:
+			kind = decodedmode_Const;
+			if (oplist->formlist[ix] == modeform_Load)
+				fatal_error("Unknown addressing mode in load operand.");
+			else
+				fatal_error("Unknown addressing mode in store operand.");
+		}
+
+		entry->modes[ix] = kind;
+		entry->operands[ix] = value;
+	}
+
+	entry->opcode = opcode;
+	entry->oplist = oplist;
+	entry->nextpc = addr;
+	entry->addr = startaddr;
+}
+
+void Glulx::parse_decoded_operands(oparg_t *args, const decodedinst_t *entry) {
+	const operandlist_t *oplist = entry->oplist;
+	int numops = oplist->num_ops;
+	int argsize = oplist->arg_size;
+
+	for (int ix = 0; ix < numops; ix++) {
+		oparg_t *curarg = &args[ix];
+		uint addr = entry->operands[ix];
+		uint value;
+
+		if (oplist->formlist[ix] != modeform_Load) {
+			/* The decoded modes match the desttype values of store_operand(). */
+			curarg->desttype = entry->modes[ix];
+			curarg->value = addr;
+			continue;
+		}
+
+		switch (entry->modes[ix]) {
+		case decodedmode_Const:
+			value = addr;
+			break;
+
+		case decodedmode_Stack:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			value = Stk4(stackptr);
+			break;
+
+		case decodedmode_Mem:
+			if (argsize == 4) {
+				value = Mem4(addr);
+			} else if (argsize == 2) {
+				value = Mem2(addr);
+			} else {
+				value = Mem1(addr);
+			}
+			break;
+
+		default: /* decodedmode_Local */
+			addr += localsbase;
+			if (argsize == 4) {
+				value = Stk4(addr);
+			} else if (argsize == 2) {
+				value = Stk2(addr);
+			} else {
+				value = Stk1(addr);
+			}
+			break;
+		}
+
+		curarg->desttype = 0;
+		curarg->value = value;
+	}
+}
+
 void Glulx::store_operand(uint desttype, uint destaddr, uint storeval) {
 	switch (desttype) {
 
@@ -86,6 +86,10 @@ void Glulx::setup_vm() {
 		memmap = nullptr;
 		fatal_error("Unable to allocate Glulx stack space.");
 	}
+	decode_cache = (decodedinst_t *)glulx_malloc(sizeof(decodedinst_t) * DECODE_CACHE_SIZE);
+	if (!decode_cache) {
+		fatal_error("Unable to allocate Glulx instruction cache.");
+	}
 	stringtable = 0;
 
 	// Initialize various other things in the terp.
@@ -115,6 +119,10 @@ void Glulx::finalize_vm() {
 		glulx_free(stack);
 		stack = nullptr;
 	}
+	if (decode_cache) {
+		glulx_free(decode_cache);
+		decode_cache = nullptr;
+	}
 
 	final_serial();
 }
@@ -128,6 +136,9 @@ void Glulx::vm_restart() {
 	/* Deactivate the heap (if it was active). */
 	heap_clear();
 
+	/* ROM is about to be reloaded from the game file. */
+	clear_decode_cache();
+
 	/* Reset memory to the original size. */
 	lx = change_memsize(origendmem, false);
 	if (lx)
@@ -1,6 +1,7 @@
 MODULE := engines/glk
 
 MODULE_OBJS := \
+	batch.o \
 	blorb.o \
 	conf.o \
 	debugger.o \
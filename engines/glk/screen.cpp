@@ -33,9 +33,14 @@ namespace Glk {
 #define FONTS_VERSION 1.0
 #define FONTS_FILENAME "fonts.dat"
 
+Screen::Screen() : Graphics::Screen() {
+}
+
 Screen::~Screen() {
 	for (int idx = 0; idx < FONTS_TOTAL; ++idx)
 		delete _fonts[idx];
+
+	freeKerning();
 }
 
 void Screen::initialize() {
@@ -97,6 +102,7 @@ void Screen::loadFonts() {
 	}
 
 	loadFonts(archive);
+	clearMetricsCache();
 
 	delete archive;
 }
@@ -183,8 +189,80 @@ size_t Screen::stringWidth(int fontIdx, const Common::String &text, int spw) {
 }
 
 size_t Screen::stringWidthUni(int fontIdx, const Common::U32String &text, int spw) {
-	const Graphics::Font *font = _fonts[fontIdx];
-	return font->getStringWidth(text) * GLI_SUBPIX;
+	return stringWidthUni(fontIdx, (const uint32 *)text.c_str(), text.size(), spw);
+}
+
+size_t Screen::stringWidthUni(int fontIdx, const uint32 *text, size_t len, int spw) {
+	// Same as Graphics::Font::getStringWidth, but using the cached metrics
+	int width = 0;
+	uint32 last = 0;
+
+	for (size_t idx = 0; idx < len; ++idx) {
+		uint32 cur = text[idx];
+		width += charWidth(fontIdx, cur) + kerningOffset(fontIdx, last, cur);
+		last = cur;
+	}
+
+	return width * GLI_SUBPIX;
+}
+
+void Screen::freeKerning() {
+	for (uint idx = 0; idx < _metrics.size(); ++idx) {
+		delete[] _metrics[idx]._kerning;
+		_metrics[idx]._kerning = nullptr;
+	}
+}
+
+void Screen::clearMetricsCache() {
+	freeKerning();
+
+	// Sub-engines may add fonts of their own after the standard ones
+	_metrics.resize(_fonts.size());
+	for (uint idx = 0; idx < _metrics.size(); ++idx) {
+		Common::fill(&_metrics[idx]._charWidths[0], &_metrics[idx]._charWidths[256], -1);
+		_metrics[idx]._kerning = nullptr;
+	}
+}
+
+int Screen::charWidth(int fontIdx, uint32 chr) {
+	if (chr >= 256 || fontIdx >= (int)_metrics.size())
+		return _fonts[fontIdx]->getCharWidth(chr);
+
+	int16 &width = _metrics[fontIdx]._charWidths[chr];
+	if (width == -1)
+		width = _fonts[fontIdx]->getCharWidth(chr);
+
+	return width;
+}
+
+int Screen::kerningOffset(int fontIdx, uint32 left, uint32 right) {
+	if (left >= 128 || right >= 128 || fontIdx >= (int)_metrics.size())
+		return _fonts[fontIdx]->getKerningOffset(left, right);
+
+	int8 *&kerning = _metrics[fontIdx]._kerning;
+	if (!kerning) {
+		kerning = new int8[128 * 128];
+		Common::fill(&kerning[0], &kerning[128 * 128], (int8)KERNING_UNKNOWN);
+	}
+
+	int8 &offset = kerning[left * 128 + right];
+	if (offset == KERNING_UNKNOWN)
+		offset = CLIP(_fonts[fontIdx]->getKerningOffset(left, right), KERNING_UNKNOWN + 1, 127);
+
+	return offset;
+}
+
+void Screen::scrollUp(const Rect &box, int dy) {
+	Rect r = box;
+	r.clip(Rect(0, 0, this->w, this->h));
+	if (dy <= 0 || dy >= r.height())
+		return;
+
+	size_t lineSize = r.width() * format.bytesPerPixel;
+	for (int y = r.top; y < r.bottom - dy; ++y)
+		memmove(getBasePtr(r.left, y), getBasePtr(r.left, y + dy), lineSize);
+
+	addDirtyRect(r);
 }
 
 } // End of namespace Glk
@@ -33,6 +33,7 @@
 namespace Glk {
 
 #define FONTS_TOTAL 8
+#define KERNING_UNKNOWN -128
 
 enum CaretShape {
 	SMALL_DOT = 0, FAT_DOT = 1, THIN_LINE = 2, FAT_LINE = 3, BLOCK = 4
@@ -53,6 +54,36 @@ private:
 	 */
 	const Graphics::Font *loadFont(FACES face, Common::Archive *archive,
 		double size, double aspect, int style);
+
+	/**
+	 * Clears the cached character widths and kerning, such as when the fonts change.
+	 * The cache is sized for the fonts loaded at the time of the call
+	 */
+	void clearMetricsCache();
+
+	/**
+	 * Returns the width of a character, using the cached widths for Latin-1 characters
+	 */
+	int charWidth(int fontIdx, uint32 chr);
+
+	/**
+	 * Returns the kerning offset between two characters, using the cached offsets for ASCII pairs
+	 */
+	int kerningOffset(int fontIdx, uint32 left, uint32 right);
+private:
+	/**
+	 * Cached metrics of a font
+	 */
+	struct FontMetrics {
+		int16 _charWidths[256];    ///< Width of each Latin-1 character, or -1 if not yet known
+		int8 *_kerning;            ///< Kerning offsets for pairs of ASCII characters, allocated on first use
+	};
+	Common::Array<FontMetrics> _metrics;    ///< Metrics for each entry of _fonts
+
+	/**
+	 * Frees the cached kerning offsets
+	 */
+	void freeKerning();
 protected:
 	Common::Array<const Graphics::Font *> _fonts;
 protected:
@@ -74,7 +105,7 @@ public:
 	/**
 	 * Constructor
 	 */
-	Screen() : Graphics::Screen() {}
+	Screen();
 
 	/**
 	 * Destructor
@@ -133,6 +164,23 @@ public:
 	 * @returns         Width of string multiplied by GLI_SUBPIX
 	 */
 	size_t stringWidthUni(int fontIdx, const Common::U32String &text, int spw = 0);
+
+	/**
+	 * Get the width in pixels of a run of unicode characters
+	 * @param fontIdx   Which font to use
+	 * @param text      Characters to get the width of
+	 * @param len       Number of characters
+	 * @param spw       Delta X
+	 * @returns         Width of the characters multiplied by GLI_SUBPIX
+	 */
+	size_t stringWidthUni(int fontIdx, const uint32 *text, size_t len, int spw = 0);
+
+	/**
+	 * Moves the contents of an area of the screen up, leaving what was at the bottom in place
+	 * @param box       Area to scroll
+	 * @param dy        Number of pixels to move it up by
+	 */
+	void scrollUp(const Rect &box, int dy);
 };
 
 } // End of namespace Glk
@@ -123,6 +123,24 @@ void WindowMask::putHyperlink(uint linkval, uint x0, uint y0, uint x1, uint y1)
 	}
 }
 
+void WindowMask::scrollHyperlinks(const Rect &box, int dy) {
+	if (!_hor || !_ver)
+		return;
+
+	size_t x0 = MAX<int>(box.left, 0), x1 = MIN<size_t>(box.right, _hor);
+	size_t y0 = MAX<int>(box.top, 0), y1 = MIN<size_t>(box.bottom, _ver);
+	if (y1 <= y0 + dy)
+		return;
+
+	for (size_t x = x0; x < x1; ++x) {
+		if (!_links[x])
+			continue;
+
+		memmove(&_links[x][y0], &_links[x][y0 + dy], (y1 - y0 - dy) * sizeof(uint));
+		Common::fill(&_links[x][y1 - dy], &_links[x][y1], 0U);
+	}
+}
+
 uint WindowMask::getHyperlink(const Point &pos) const {
 	if (!_hor || !_ver) {
 		warning("getHyperlink: struct not initialized");
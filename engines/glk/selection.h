@@ -92,6 +92,11 @@ public:
 	void putHyperlink(uint linkval, uint x0, uint y0, uint x1, uint y1);
 
 	uint getHyperlink(const Point &pos) const;
+
+	/**
+	 * Moves the hyperlinks within an area up, matching an area of the screen being scrolled
+	 */
+	void scrollHyperlinks(const Rect &box, int dy);
 };
 
 /**
@@ -21,6 +21,7 @@
  */
 
 #include "glk/streams.h"
+#include "glk/batch.h"
 #include "glk/conf.h"
 #include "glk/events.h"
 #include "glk/glk.h"
@@ -103,6 +104,8 @@ void WindowStream::putChar(unsigned char ch) {
 	}
 
 	_window->putCharUni(ch);
+	if (g_vm->_batch->isActive())
+		g_vm->_batch->capture(_window, ch);
 	if (_window->_echoStream)
 		_window->_echoStream->putChar(ch);
 }
@@ -122,6 +125,8 @@ void WindowStream::putCharUni(uint32 ch) {
 	}
 
 	_window->putCharUni(ch);
+	if (g_vm->_batch->isActive())
+		g_vm->_batch->capture(_window, ch);
 	if (_window->_echoStream)
 		_window->_echoStream->putCharUni(ch);
 }
@@ -140,8 +145,12 @@ void WindowStream::putBuffer(const char *buf, size_t len) {
 		}
 	}
 
-	for (size_t lx = 0; lx < len; lx++, buf++)
+	bool capture = g_vm->_batch->isActive();
+	for (size_t lx = 0; lx < len; lx++, buf++) {
 		_window->putCharUni(*buf);
+		if (capture)
+			g_vm->_batch->capture(_window, (byte)*buf);
+	}
 	if (_window->_echoStream)
 		_window->_echoStream->putBuffer(buf, len);
 }
@@ -160,8 +169,12 @@ void WindowStream::putBufferUni(const uint32 *buf, size_t len) {
 		}
 	}
 
-	for (size_t lx = 0; lx < len; lx++, buf++)
+	bool capture = g_vm->_batch->isActive();
+	for (size_t lx = 0; lx < len; lx++, buf++) {
 		_window->putCharUni(*buf);
+		if (capture)
+			g_vm->_batch->capture(_window, *buf);
+	}
 	if (_window->_echoStream)
 		_window->_echoStream->putBufferUni(buf, len);
 }
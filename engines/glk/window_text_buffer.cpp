@@ -38,7 +38,7 @@ namespace Glk {
 
 TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : TextWindow(windows, rock),
 		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
-		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
+		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollShift(-1), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
 		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
 		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
 		_copyBuf(0), _copyPos(0) {
@@ -81,6 +81,8 @@ void TextBufferWindow::rearrange(const Rect &box) {
 	int newwid, newhgt;
 	int rnd;
 
+	_scrollShift = -1;
+
 	newwid = MAX((box.width() - g_conf->_tMarginX * 2 - g_conf->_scrollWidth) / _font._cellW, 0);
 	newhgt = MAX((box.height() - g_conf->_tMarginY * 2) / _font._cellH, 0);
 
@@ -240,6 +242,7 @@ void TextBufferWindow::reflow() {
 void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
+	_scrollShift = -1;
 
 	for (int i = 0; i < _scrollMax; i++)
 		_lines[i]._dirty = true;
@@ -563,6 +566,7 @@ void TextBufferWindow::clear() {
 	_lastSeen = 0;
 	_scrollPos = 0;
 	_scrollMax = 0;
+	_scrollShift = -1;
 
 	for (i = 0; i < _height; i++)
 		touch(i);
@@ -839,6 +843,14 @@ void TextBufferWindow::redraw() {
 	// check if any part of buffer is selected
 	selBuf = g_vm->_selection->checkSelection(Rect(x0 / GLI_SUBPIX, y0, x1 / GLI_SUBPIX, y1));
 
+	if (_scrollShift > 0) {
+		// A selection being dragged is drawn over the rows, so they can't be moved
+		if (selBuf || Windows::_forceRedraw)
+			touchDrawnRows();
+		else
+			scrollDrawnRows(x0, y0, x1);
+	}
+
 	for (i = _scrollPos + _height - 1; i >= _scrollPos; i--) {
 		// top of line
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
@@ -857,12 +869,12 @@ void TextBufferWindow::redraw() {
 		if (selrow)
 			_lines[i]._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
-
 		// skip if we can
-		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
+		if (!_lines[i]._dirty && !_lines[i]._repaint && !Windows::_forceRedraw && _scrollPos == 0)
 			continue;
 
+		TextBufferRow ln(_lines[i]);
+
 		// repaint previously selected lines if needed
 		if (ln._repaint && !Windows::_forceRedraw)
 			_windows->redrawRect(Rect(x0 / GLI_SUBPIX, y,
@@ -986,7 +998,7 @@ void TextBufferWindow::redraw() {
 				link = ln._attrs[a].hyper;
 				font = ln._attrs[a].attrFont(_styles);
 				color = ln._attrs[a].attrBg(_styles);
-				w = screen.stringWidthUni(font, Common::U32String(ln._chars + a, b - a), spw);
+				w = screen.stringWidthUni(font, ln._chars + a, b - a, spw);
 				screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX, y, w / GLI_SUBPIX, _font._leading),
 								color);
 				if (link) {
@@ -1003,7 +1015,7 @@ void TextBufferWindow::redraw() {
 		link = ln._attrs[a].hyper;
 		font = ln._attrs[a].attrFont(_styles);
 		color = ln._attrs[a].attrBg(_styles);
-		w = screen.stringWidthUni(font, Common::U32String(ln._chars + a, b - a), spw);
+		w = screen.stringWidthUni(font, ln._chars + a, b - a, spw);
 		screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX, y, w / GLI_SUBPIX, _font._leading), color);
 		if (link) {
 			screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX + 1, y + _font._baseLine + 1,
@@ -1088,7 +1100,9 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
+		if (!ln._lPic && !ln._rPic)
+			continue;
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1176,6 +1190,30 @@ void TextBufferWindow::redraw() {
 	// no more prompt means all text has been seen
 	if (!_moreRequest)
 		_lastSeen = 0;
+
+	// What's on screen can be reused for further scrolling if it's showing the most recent text
+	_scrollShift = (_scrollPos == 0) ? 0 : -1;
+}
+
+void TextBufferWindow::scrollDrawnRows(int x0, int y0, int x1) {
+	Rect area(x0 / GLI_SUBPIX, y0, x1 / GLI_SUBPIX, y0 + _height * _font._leading);
+	int dy = _scrollShift * _font._leading;
+	_scrollShift = 0;
+
+	if (_scrollPos != 0 || dy <= 0 || dy >= area.height()) {
+		touchDrawnRows();
+		return;
+	}
+
+	g_vm->_screen->scrollUp(area, dy);
+	g_vm->_selection->scrollHyperlinks(area, dy);
+}
+
+void TextBufferWindow::touchDrawnRows() {
+	_scrollShift = 0;
+
+	for (int i = _scrollPos; i < _scrollPos + _height; i++)
+		_lines[i]._dirty = true;
 }
 
 int TextBufferWindow::acceptScroll(uint arg) {
@@ -1528,6 +1566,10 @@ bool TextBufferWindow::leftquote(uint32 c) {
 }
 
 void TextBufferWindow::scrollOneLine(bool forced) {
+	// Lines that are already drawn can simply be moved up the screen, as long as the
+	// window is showing the most recent text both before and after the scroll
+	bool shiftDrawn = _scrollShift >= 0 && _scrollPos == 0;
+
 	_lastSeen++;
 	_scrollMax++;
 
@@ -1543,6 +1585,8 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	if (_scrollPos < 0)
 		_scrollPos = 0;
 
+	shiftDrawn = shiftDrawn && _scrollPos == 0 && _scrollShift + 1 < _height;
+
 	if (forced)
 		_dashed = 0;
 	_spaced = 0;
@@ -1550,11 +1594,9 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	_lines.rotate();
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
 
 	if (_radjn)
 		_radjn--;
@@ -1582,14 +1624,18 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 
 	_numChars = 0;
 
-	touchScroll();
-
+	if (shiftDrawn) {
+		// Only the new line and the one it pushed up (which may still have the caret) need drawing
+		++_scrollShift;
+		touch(1);
+	} else {
+		touchScroll();
+	}
 }
 
 void TextBufferWindow::scrollResize() {
 	int i;
 
-	_lines.clear();
 	_lines.resize(_scrollBack + SCROLLBACK);
 
 	_chars = _lines[0]._chars;
@@ -1621,13 +1667,12 @@ int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, in
 	a = startchar;
 	for (b = startchar; b < numChars; b++) {
 		if (attrs[a] != attrs[b]) {
-			w += screen.stringWidthUni(attrs[a].attrFont(_styles),
-									   Common::U32String(chars + a, b - a), spw);
+			w += screen.stringWidthUni(attrs[a].attrFont(_styles), chars + a, b - a, spw);
 			a = b;
 		}
 	}
 
-	w += screen.stringWidthUni(attrs[a].attrFont(_styles), Common::U32String(chars + a, b - a), spw);
+	w += screen.stringWidthUni(attrs[a].attrFont(_styles), chars + a, b - a, spw);
 
 	return w;
 }
@@ -1646,6 +1691,23 @@ void TextBufferWindow::flowBreak() {
 
 /*--------------------------------------------------------------------------*/
 
+void TextBufferWindow::TextBufferRows::resize(uint newSize) {
+	if (_start == 0) {
+		_rows.resize(newSize);
+		return;
+	}
+
+	// Put the rows back in order before adding the new ones after them
+	Common::Array<TextBufferRow> rows;
+	rows.reserve(newSize);
+	for (uint idx = 0; idx < _rows.size(); ++idx)
+		rows.push_back((*this)[idx]);
+	rows.resize(newSize);
+
+	_rows = rows;
+	_start = 0;
+}
+
 TextBufferWindow::TextBufferRow::TextBufferRow() : _len(0), _newLine(0), _dirty(false),
 	_repaint(false), _lPic(nullptr), _rPic(nullptr), _lHyper(0), _rHyper(0),
 	_lm(0), _rm(0) {
@@ -53,7 +53,50 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * Scrollback rows, with row 0 being the current line. The rows are kept in a ring,
+	 * so scrolling in a new line doesn't have to move all the existing ones
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _start;
+	public:
+		/**
+		 * Constructor
+		 */
+		TextBufferRows() : _start(0) {}
+
+		/**
+		 * Returns the given row, counting back from the current line
+		 */
+		TextBufferRow &operator[](int idx) {
+			return _rows[(_start + idx) % _rows.size()];
+		}
+		const TextBufferRow &operator[](int idx) const {
+			return _rows[(_start + idx) % _rows.size()];
+		}
+
+		/**
+		 * Returns the number of rows
+		 */
+		uint size() const {
+			return _rows.size();
+		}
+
+		/**
+		 * Resizes the scrollback, keeping the existing rows. New rows are added at the oldest end
+		 */
+		void resize(uint newSize);
+
+		/**
+		 * Scrolls the rows by one, so the oldest row becomes the new current line
+		 */
+		void rotate() {
+			_start = (_start + _rows.size() - 1) % _rows.size();
+		}
+	};
 private:
 	PropFontInfo &_font;
 private:
@@ -90,6 +133,18 @@ private:
 	void touch(int line);
 
 	void scrollOneLine(bool forced);
+
+	/**
+	 * Scrolls the pixels of rows that are already on-screen up, for lines scrolled in since
+	 * the last redraw, so only the rows that changed need to be drawn again
+	 */
+	void scrollDrawnRows(int x0, int y0, int x1);
+
+	/**
+	 * Marks all visible rows for drawing, for when the pixels of rows scrolled since the
+	 * last redraw can't be moved. Unlike touchScroll, this keeps the selection
+	 */
+	void touchDrawnRows();
 	void scrollResize();
 	int calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numchars, int spw);
 public:
@@ -119,6 +174,7 @@ public:
 	int _lastSeen;
 	int _scrollPos;
 	int _scrollMax;
+	int _scrollShift;     ///< lines scrolled since the last redraw, or -1 if the screen can't be reused
 
 	// for line input
 	void *_inBuf;        ///< unsigned char* for latin1, uint* for unicode
@@ -135,7 +135,7 @@ Opcode Processor::ext_opcodes[64] = {
 Processor::Processor(OSystem *syst, const GlkGameDescription &gameDesc) :
 		GlkInterface(syst, gameDesc),
 		_finished(0), _sp(nullptr), _fp(nullptr), _frameCount(0),
-		zargc(0), _decoded(nullptr), _encoded(nullptr), _resolution(0),
+		zargc(0), _decoded(nullptr), _encoded(nullptr), _zchars(nullptr), _resolution(0),
 		_randomInterval(0), _randomCtr(0), first_restart(true), script_valid(false),
 		_bufPos(0), _locked(false), _prevC('\0'), script_width(0),
 		sfp(nullptr), rfp(nullptr), pfp(nullptr), ostream_screen(true), ostream_script(false),
@@ -187,6 +187,13 @@ Processor::Processor(OSystem *syst, const GlkGameDescription &gameDesc) :
 	Common::fill(&_errorCount[0], &_errorCount[ERR_NUM_ERRORS], 0);
 }
 
+Processor::~Processor() {
+	// Dictionary buffers allocated by find_resolution
+	free(_decoded);
+	free(_encoded);
+	free(_zchars);
+}
+
 void Processor::initialize() {
 	Mem::initialize();
 	GlkInterface::initialize();
@@ -198,6 +205,9 @@ void Processor::initialize() {
 		op0_opcodes[9] = &Processor::z_catch;
 		op1_opcodes[15] = &Processor::z_call_n;
 	}
+
+	_decodeCache.clear();
+	_decodeCache.resize(INSTRUCTION_CACHE_SIZE);
 }
 
 void Processor::load_operand(zbyte type) {
@@ -208,15 +218,7 @@ void Processor::load_operand(zbyte type) {
 		zbyte variable;
 
 		CODE_BYTE(variable);
-
-		if (variable == 0)
-			value = *_sp++;
-		else if (variable < 16)
-			value = *(_fp - variable);
-		else {
-			zword addr = h_globals + 2 * (variable - 16);
-			LOW_WORD(addr, value);
-		}
+		value = readVariable(variable);
 	} else if (type & 1) {
 		// small constant
 		zbyte bvalue;
@@ -243,8 +245,94 @@ void Processor::load_all_operands(zbyte specifier) {
 	}
 }
 
+void Processor::decode_operand(DecodedInstruction &inst, const zbyte *&p, zbyte type) {
+	if (type & 2) {
+		// variable
+		inst._variables |= 1 << inst._argc;
+		inst._values[inst._argc] = *p++;
+	} else if (type & 1) {
+		// small constant
+		inst._values[inst._argc] = *p++;
+	} else {
+		// large constant
+		inst._values[inst._argc] = READ_BE_UINT16(p);
+		p += 2;
+	}
+
+	++inst._argc;
+}
+
+void Processor::decode_instruction(uint32 addr, DecodedInstruction &inst) {
+	const zbyte *p = zmp + addr;
+	zbyte opcode = *p++;
+
+	inst._addr = addr;
+	inst._argc = 0;
+	inst._variables = 0;
+
+	if (opcode < 0x80) {
+		// 2OP opcodes
+		decode_operand(inst, p, (opcode & 0x40) ? 2 : 1);
+		decode_operand(inst, p, (opcode & 0x20) ? 2 : 1);
+		inst._handler = var_opcodes[opcode & 0x1f];
+
+	} else if (opcode < 0xb0) {
+		// 1OP opcodes
+		decode_operand(inst, p, opcode >> 4);
+		inst._handler = op1_opcodes[opcode & 0x0f];
+
+	} else if (opcode < 0xc0) {
+		// 0OP opcodes
+		inst._handler = op0_opcodes[opcode - 0xb0];
+
+	} else {
+		// VAR opcodes, with the call opcodes 0xec and 0xfa taking two type specifier bytes
+		zbyte specifiers[2];
+		int specifierCount = (opcode == 0xec || opcode == 0xfa) ? 2 : 1;
+
+		for (int idx = 0; idx < specifierCount; ++idx)
+			specifiers[idx] = *p++;
+
+		for (int idx = 0; idx < specifierCount; ++idx) {
+			for (int i = 6; i >= 0; i -= 2) {
+				zbyte type = (specifiers[idx] >> i) & 0x03;
+				if (type == 3)
+					break;
+
+				decode_operand(inst, p, type);
+			}
+		}
+
+		inst._handler = var_opcodes[opcode - 0xc0];
+	}
+
+	inst._length = p - (zmp + addr);
+}
+
 void Processor::interpret() {
 	do {
+		uint32 pc = pcp - zmp;
+
+		if (pc >= h_dynamic_size) {
+			// Static memory can't change, so instructions there only need decoding once
+			DecodedInstruction &inst = _decodeCache[pc & (INSTRUCTION_CACHE_SIZE - 1)];
+			if (inst._addr != pc)
+				decode_instruction(pc, inst);
+
+			pcp += inst._length;
+			zargc = inst._argc;
+			for (int i = 0; i < zargc; ++i)
+				zargs[i] = (inst._variables & (1 << i)) ? readVariable(inst._values[i]) : inst._values[i];
+
+			(*this.*inst._handler)();
+
+#if defined(DJGPP) && defined(SOUND_SUPPORT)
+			if (end_of_sound_flag)
+				end_of_sound();
+#endif
+			continue;
+		}
+
 		zbyte opcode;
 		CODE_BYTE(opcode);
 		zargc = 0;
@@ -26,12 +26,15 @@
 #include "glk/zcode/mem.h"
 #include "glk/zcode/glk_interface.h"
 #include "glk/zcode/frotz_types.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/stack.h"
 
 namespace Glk {
 namespace ZCode {
 
 #define TEXT_BUFFER_SIZE 200
+#define INSTRUCTION_CACHE_SIZE 2048
 
 #define CODE_BYTE(v)	   v = codeByte()
 #define CODE_WORD(v)       v = codeWord()
@@ -47,6 +50,25 @@ class Processor;
 class Quetzal;
 typedef void (Processor::*Opcode)();
 
+/**
+ * An instruction from static memory, with its opcode and operand types already decoded
+ */
+struct DecodedInstruction {
+	uint32 _addr;               ///< Address of the instruction, or 0 if the entry is unused
+	Opcode _handler;            ///< Opcode method to execute
+	zbyte _length;              ///< Size of the opcode, type specifiers, and operands
+	zbyte _argc;                ///< Number of operands
+	zbyte _variables;           ///< Bit mask of which operands are variable numbers
+	zword _values[8];           ///< Constant operand values, or variable numbers
+
+	DecodedInstruction() : _addr(0), _handler(nullptr), _length(0), _argc(0), _variables(0) {}
+};
+
+/**
+ * Maps the encoded form of each word in a dictionary to its entry address
+ */
+typedef Common::HashMap<uint, zword> DictionaryIndex;
+
 /**
  * Zcode processor
  */
@@ -62,6 +84,7 @@ private:
 	int _finished;
 	zword zargs[8];
 	int zargc;
+	Common::Array<DecodedInstruction> _decodeCache;
 	uint _randomInterval;
 	uint _randomCtr;
 	bool first_restart;
@@ -76,7 +99,9 @@ private:
 	// Text related fields
 	static zchar ZSCII_TO_LATIN1[];
 	zchar *_decoded, *_encoded;
+	zbyte *_zchars;
 	int _resolution;
+	Common::HashMap<uint, DictionaryIndex> _dictionaryIndexes;
 	int _errorCount[ERR_NUM_ERRORS];
 
 	// Buffer related fields
@@ -112,6 +137,28 @@ protected:
 	 */
 	void load_all_operands(zbyte specifier);
 
+	/**
+	 * Returns the value of a variable: 0 pops the stack, 1-15 are locals, and 16+ are globals
+	 */
+	zword readVariable(zbyte variable) {
+		if (variable == 0)
+			return *_sp++;
+		else if (variable < 16)
+			return *(_fp - variable);
+		else
+			return READ_BE_UINT16(&zmp[(zword)(h_globals + 2 * (variable - 16))]);
+	}
+
+	/**
+	 * Decode the instruction at a given address in static memory into a decode cache entry
+	 */
+	void decode_instruction(uint32 addr, DecodedInstruction &inst);
+
+	/**
+	 * Decode a single operand of the given type for a cached instruction
+	 */
+	void decode_operand(DecodedInstruction &inst, const zbyte *&p, zbyte type);
+
 	/**
 	 * Call a subroutine. Save PC and FP then load new PC and initialise
 	 * new stack frame. Note that the caller may legally provide less or
@@ -644,6 +691,20 @@ protected:
 	 */
 	zword lookup_text(int padding, zword dct);
 
+	/**
+	 * Returns the key used for the encoded word in dictionary indexes
+	 */
+	uint dictionary_key(const zchar *encoded) const;
+
+	/**
+	 * Looks up the current encoded word in a hashed index of a dictionary in static memory.
+	 * The index is built the first time a given dictionary is searched.
+	 * @param dct       Address of the dictionary
+	 * @param entryAddr Returns the address of the matching entry, or 0 if there isn't one
+	 * @returns         True if the index could be used
+	 */
+	bool lookup_indexed(zword dct, zword &entryAddr);
+
 	/**
 	 * Handles converting abbreviations that weren't handled by early Infocom games
 	 * into their expanded versions
@@ -1703,7 +1764,7 @@ public:
 	 * Constructor
 	 */
 	Processor(OSystem *syst, const GlkGameDescription &gameDesc);
-	~Processor() override {}
+	~Processor() override;
 
 	/**
 	 * Initialization
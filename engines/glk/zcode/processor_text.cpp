@@ -191,6 +191,7 @@ void Processor::find_resolution() {
 
 	_decoded = (zchar *)malloc(sizeof(zchar) * (3 * _resolution) + 1);
 	_encoded = (zchar *)malloc(sizeof(zchar) * _resolution);
+	_zchars = (zbyte *)malloc(sizeof(zbyte) * 3 * (_resolution + 1));
 }
 
 void Processor::load_string(zword addr, zword length) {
@@ -224,7 +225,7 @@ void Processor::encode_text(int padding) {
 
 	if (_resolution == 0) find_resolution();
 
-	zchars = new byte[3 * (_resolution + 1)];
+	zchars = _zchars;
 	ptr = _decoded;
 
 	// Expand abbreviations that some old Infocom games lack
@@ -284,7 +285,6 @@ void Processor::encode_text(int padding) {
 			(zchars[3 * i + 2]);
 
 	_encoded[_resolution - 1] |= 0x8000;
-	delete[]  zchars;
 }
 
 #define outchar(c)	if (st == VOCABULARY) *ptr++=c; else print_char(c)
@@ -495,6 +495,9 @@ zword Processor::lookup_text(int padding, zword dct) {
 
 	encode_text(padding);
 
+	if (padding == 0x05 && lookup_indexed(dct, entry_addr))
+		return entry_addr;
+
 	LOW_BYTE(dct, sep_count);		// skip word separators
 	dct += 1 + sep_count;
 	LOW_BYTE(dct, entry_len);		// get length of entries
@@ -561,6 +564,70 @@ zword Processor::lookup_text(int padding, zword dct) {
 	return dct + entry_number * entry_len;
 }
 
+uint Processor::dictionary_key(const zchar *encoded) const {
+	uint key = 0;
+	for (int i = 0; i < _resolution; ++i)
+		key = (key << 16 | key >> 16) ^ encoded[i];
+
+	return key;
+}
+
+bool Processor::lookup_indexed(zword dct, zword &entryAddr) {
+	// Dictionaries in dynamic memory may be changed by the game, so they are always searched
+	if (dct < h_dynamic_size)
+		return false;
+
+	if (!_dictionaryIndexes.contains(dct)) {
+		DictionaryIndex &index = _dictionaryIndexes[dct];
+		zchar *encoded = new zchar[_resolution];
+		zword addr = dct;
+		zword entry_count;
+		zbyte entry_len;
+		zbyte sep_count;
+
+		LOW_BYTE(addr, sep_count);
+		addr += 1 + sep_count;
+		LOW_BYTE(addr, entry_len);
+		addr += 1;
+		LOW_WORD(addr, entry_count);
+		addr += 2;
+
+		if ((short)entry_count < 0)
+			entry_count = -(short)entry_count;
+
+		for (uint idx = 0; idx < entry_count; ++idx, addr += entry_len) {
+			for (int i = 0; i < _resolution; ++i)
+				LOW_WORD(addr + 2 * i, encoded[i]);
+
+			// Keep the first entry for any key, matching what a linear search finds
+			uint key = dictionary_key(encoded);
+			if (!index.contains(key))
+				index[key] = addr;
+		}
+
+		delete[] encoded;
+	}
+
+	const DictionaryIndex &index = _dictionaryIndexes[dct];
+	DictionaryIndex::const_iterator it = index.find(dictionary_key(_encoded));
+	if (it == index.end()) {
+		// No entry has the same key, so the word can't be in the dictionary
+		entryAddr = 0;
+		return true;
+	}
+
+	// Confirm the match, since different words can share a key
+	for (int i = 0; i < _resolution; ++i) {
+		zword entry;
+		LOW_WORD(it->_value + 2 * i, entry);
+		if (entry != _encoded[i])
+			return false;
+	}
+
+	entryAddr = it->_value;
+	return true;
+}
+
 void Processor::handleAbbreviations() {
 	// Construct a unicode string containing the word
 	int wordSize = 0;
@@ -20,12 +20,17 @@
  *
  */
 
+#define FORBIDDEN_SYMBOL_EXCEPTION_setjmp
+#define FORBIDDEN_SYMBOL_EXCEPTION_longjmp
+
 #include "common/config-manager.h"
 #include "graphics/renderer.h"
 
 #include "engines/grim/debugger.h"
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
+#include "engines/grim/lua/lgc.h"
+#include "engines/grim/lua/lstate.h"
 
 namespace Grim {
 
@@ -38,6 +43,7 @@ Debugger::Debugger() :
 	registerCmd("set_renderer", WRAP_METHOD(Debugger, cmd_set_renderer));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("lua_gc", WRAP_METHOD(Debugger, cmd_lua_gc));
 }
 
 Debugger::~Debugger() {
@@ -127,4 +133,19 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_lua_gc(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Usage: lua_gc [reset]\n");
+		return true;
+	}
+
+	debugPrintf("Blocks in use: %d, next collection at: %d\n", nblocks, GCthreshold);
+	debugPrintf("Collections: %u, last recovered: %d blocks\n", gcStats.collections, gcStats.lastRecovered);
+	debugPrintf("Pause (ms): last %u, max %u, total %u\n", gcStats.lastPause, gcStats.maxPause, gcStats.totalPause);
+
+	if (argc == 2)
+		memset(&gcStats, 0, sizeof(gcStats));
+	return true;
+}
+
 }
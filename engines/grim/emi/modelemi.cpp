@@ -218,6 +218,7 @@ void EMIModel::setSkeleton(Skeleton *skel) {
 		return;
 	}
 	_skeleton = skel;
+	_skinnedRevision = 0;
 	if (!skel || !_numBoneInfos) {
 		return;
 	}
@@ -232,6 +233,12 @@ void EMIModel::prepareForRender() {
 	if (!_skeleton || !_vertexBoneInfo)
 		return;
 
+	// The skinned vertices are still valid if the pose has not changed
+	// since they were computed.
+	if (_skinnedRevision == _skeleton->getPoseRevision())
+		return;
+	_skinnedRevision = _skeleton->getPoseRevision();
+
 	for (int i = 0; i < _numVertices; i++) {
 		_drawVertices[i].set(0.0f, 0.0f, 0.0f);
 		_drawNormals[i].set(0.0f, 0.0f, 0.0f);
@@ -445,6 +452,7 @@ EMIModel::EMIModel(const Common::String &filename, Common::SeekableReadStream *d
 	_numBoneInfos = 0;
 	_vertexBoneInfo = nullptr;
 	_skeleton = nullptr;
+	_skinnedRevision = 0;
 	_radius = 0;
 	_center = new Math::Vector3d();
 	_boxData = new Math::Vector3d();
@@ -106,6 +106,7 @@ public:
 	Material **_mats;
 
 	Skeleton *_skeleton;
+	uint32 _skinnedRevision;
 
 	int _numBones;
 
@@ -33,8 +33,12 @@ namespace Grim {
 #define ROTATE_OP 4
 #define TRANSLATE_OP 3
 
+// Pose revisions are unique across skeletons, so a mesh never mistakes a
+// new skeleton for the one it was last skinned against.
+static uint32 s_poseRevision = 0;
+
 Skeleton::Skeleton(const Common::String &filename, Common::SeekableReadStream *data) :
-		_numJoints(0), _joints(nullptr), _animLayers(nullptr) {
+		_numJoints(0), _joints(nullptr), _poseRevision(++s_poseRevision), _animLayers(nullptr) {
 	loadSkeleton(data);
 }
 
@@ -171,16 +175,26 @@ void Skeleton::removeAnimation(AnimationStateEmi *anim) {
 }
 
 void Skeleton::commitAnim() {
+	bool changed = false;
 	for (int m = 0; m < _numJoints; ++m) {
 		const Joint *parent = getParentJoint(&_joints[m]);
+		Math::Matrix4 finalMatrix;
 		if (parent) {
-			_joints[m]._finalMatrix = parent->_finalMatrix * _joints[m]._animMatrix;
+			finalMatrix = parent->_finalMatrix * _joints[m]._animMatrix;
 			_joints[m]._finalQuat = parent->_finalQuat * _joints[m]._animQuat;
 		} else {
-			_joints[m]._finalMatrix = _joints[m]._animMatrix;
+			finalMatrix = _joints[m]._animMatrix;
 			_joints[m]._finalQuat = _joints[m]._animQuat;
 		}
+		if (!changed && finalMatrix != _joints[m]._finalMatrix)
+			changed = true;
+		_joints[m]._finalMatrix = finalMatrix;
 	}
+
+	// Let the meshes bound to this skeleton skip skinning while it holds
+	// still, which is the common case for set props.
+	if (changed)
+		_poseRevision = ++s_poseRevision;
 }
 
 int Skeleton::findJointIndex(const Common::String &name) const {
@@ -92,7 +92,10 @@ public:
 	Joint *getParentJoint(const Joint *j) const;
 	int getJointIndex(const Joint *j) const;
 	AnimationLayer* getLayer(int priority) const;
+	// Changes whenever commitAnim() moves a joint's final matrix.
+	uint32 getPoseRevision() const { return _poseRevision; }
 private:
+	uint32 _poseRevision;
 	AnimationLayer *_animLayers;
 	Common::List<AnimationStateEmi*> _activeAnims;
 };
@@ -17,8 +17,12 @@
 #include "engines/grim/lua/ltm.h"
 #include "engines/grim/lua/lua.h"
 
+#include "common/system.h"
+
 namespace Grim {
 
+GCStats gcStats;
+
 static int32 markobject (TObject *o);
 
 /*
@@ -32,7 +36,7 @@ int32 luaC_ref(TObject *o, int32 lock) {
 	if (ttype(o) == LUA_T_NIL)
 		ref = -1;   // special ref for nil
 	else {
-		for (ref = 0; ref < refSize; ref++)
+		for (ref = refFree; ref < refSize; ref++)
 			if (refArray[ref].status == FREE)
 				goto found;
 		// no more empty spaces
@@ -49,6 +53,7 @@ int32 luaC_ref(TObject *o, int32 lock) {
 found:
 		refArray[ref].o = *o;
 		refArray[ref].status = lock ? LOCK : HOLD;
+		refFree = ref + 1;
 	}
 	return ref;
 }
@@ -58,6 +63,8 @@ void lua_unref(int32 r) {
 		refArray[r].status = FREE;
 		refArray[r].o.ttype = LUA_T_NIL;
 		refArray[r].o.value.ts = nullptr;
+		if (r < refFree)
+			refFree = r;
 	}
 }
 
@@ -231,6 +238,7 @@ static void markall() {
 }
 
 int32 lua_collectgarbage(int32 limit) {
+	uint32 startTime = g_system->getMillis();
 	int32 recovered = nblocks;  // to subtract nblocks after gc
 	Hash *freetable;
 	TaggedString *freestr;
@@ -252,6 +260,14 @@ int32 lua_collectgarbage(int32 limit) {
 	luaF_freeclosure(freeclos);
 	recovered = recovered - nblocks;
 	GCthreshold = (limit == 0) ? 2 * nblocks : nblocks + limit;
+
+	uint32 pause = g_system->getMillis() - startTime;
+	gcStats.collections++;
+	gcStats.lastPause = pause;
+	gcStats.totalPause += pause;
+	if (pause > gcStats.maxPause)
+		gcStats.maxPause = pause;
+	gcStats.lastRecovered = recovered;
 	return recovered;
 }
 
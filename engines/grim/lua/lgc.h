@@ -11,6 +11,16 @@
 
 namespace Grim {
 
+struct GCStats {
+	uint32 collections;
+	uint32 lastPause;   // in ms
+	uint32 maxPause;
+	uint32 totalPause;
+	int32 lastRecovered;  // in blocks
+};
+
+extern GCStats gcStats;
+
 void luaC_checkGC();
 TObject* luaC_getref(int32 r);
 int32 luaC_ref(TObject *o, int32 lock);
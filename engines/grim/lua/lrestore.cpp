@@ -441,6 +441,7 @@ void lua_Restore(SaveGame *savedState) {
 	} else {
 		refArray = nullptr;
 	}
+	refFree = 0;
 
 	GCthreshold = savedState->readLESint32();
 	nblocks = savedState->readLESint32();
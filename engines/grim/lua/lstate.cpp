@@ -40,6 +40,7 @@ GCnode rootglobal;
 GCnode roottable;
 struct ref *refArray;
 int32 refSize;
+int32 refFree;
 int32 GCthreshold;
 int32 nblocks;
 int32 Mbuffsize;
@@ -130,6 +131,7 @@ void lua_resetglobals() {
 	roottable.marked = 0;
 	refArray = nullptr;
 	refSize = 0;
+	refFree = 0;
 	GCthreshold = GARBAGE_BLOCK;
 	nblocks = 0;
 
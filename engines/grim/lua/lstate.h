@@ -74,6 +74,7 @@ extern GCnode rootglobal;
 extern GCnode roottable;
 extern struct ref *refArray;
 extern int32 refSize;
+extern int32 refFree;  // no FREE refs below this index
 extern int32 GCthreshold;
 extern int32 nblocks;
 extern int32 Mbuffsize;
@@ -101,7 +101,7 @@ static TaggedString *insert(const char *buff, int32 tag, stringtable *tb) {
 		if (ts == &EMPTY)
 			j = i;
 		else if ((ts->constindex >= 0) ? // is a string?
-				(tag == LUA_T_STRING && (strcmp(buff, ts->str) == 0)) :
+				(tag == LUA_T_STRING && ts->hash == h && (strcmp(buff, ts->str) == 0)) :
 				((tag == ts->globalval.ttype || tag == LUA_ANYTAG) && buff == (const char *)ts->globalval.value.ts))
 			return ts;
 		if (++i == size)
@@ -227,25 +227,36 @@ MaterialData::~MaterialData() {
 	delete[] _textures;
 }
 
-MaterialData *MaterialData::getMaterialData(const Common::String &filename, Common::SeekableReadStream *data, CMap *cmap) {
+MaterialData *MaterialData::findMaterialData(const Common::String &filename, CMap *cmap) {
 	if (!_materials) {
-		_materials = new Common::List<MaterialData *>();
+		return nullptr;
 	}
 
 	for (Common::List<MaterialData *>::iterator i = _materials->begin(); i != _materials->end(); ++i) {
 		MaterialData *m = *i;
 		if (m->_fname == filename && g_grim->getGameType() == GType_MONKEY4) {
-			++m->_refCount;
 			return m;
 		}
 		// We need to allow null cmaps for remastered overlays
 		if (m->_fname == filename && (!(m->_cmap || cmap) || m->_cmap->getFilename() == cmap->getFilename())) {
-			++m->_refCount;
 			return m;
 		}
 	}
+	return nullptr;
+}
+
+MaterialData *MaterialData::getMaterialData(const Common::String &filename, Common::SeekableReadStream *data, CMap *cmap) {
+	MaterialData *m = findMaterialData(filename, cmap);
+	if (m) {
+		++m->_refCount;
+		return m;
+	}
+
+	if (!_materials) {
+		_materials = new Common::List<MaterialData *>();
+	}
 
-	MaterialData *m = new MaterialData(filename, data, cmap);
+	m = new MaterialData(filename, data, cmap);
 	_materials->push_back(m);
 	return m;
 }
@@ -49,6 +49,8 @@ public:
 	~MaterialData();
 
 	static MaterialData *getMaterialData(const Common::String &filename, Common::SeekableReadStream *data, CMap *cmap);
+	// Returns the already loaded data for the given file and colormap, if any.
+	static MaterialData *findMaterialData(const Common::String &filename, CMap *cmap);
 	static Common::List<MaterialData *> *_materials;
 
 	Common::String _fname;
@@ -441,6 +441,11 @@ LipSync *ResourceLoader::loadLipSync(const Common::String &filename) {
 Material *ResourceLoader::loadMaterial(const Common::String &filename, CMap *c, bool clamp) {
 	Common::String fname = fixFilename(filename, false);
 	fname.toLowercase();
+	// Materials shared between models and costumes only need their file
+	// read and decoded once.
+	if (MaterialData::findMaterialData(fname, c))
+		return new Material(fname, nullptr, c, clamp);
+
 	Common::SeekableReadStream *stream;
 
 	stream = openNewStreamFile(fname.c_str(), true);
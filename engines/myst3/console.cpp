@@ -25,6 +25,7 @@
 #include "engines/myst3/archive.h"
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/inventory.h"
 #include "engines/myst3/script.h"
 #include "engines/myst3/state.h"
@@ -44,6 +45,7 @@ Console::Console(Myst3Engine *vm) : GUI::Debugger(), _vm(vm) {
 	registerCmd("fillInventory",			WRAP_METHOD(Console, Cmd_FillInventory));
 	registerCmd("dumpArchive",			WRAP_METHOD(Console, Cmd_DumpArchive));
 	registerCmd("dumpMasks",			WRAP_METHOD(Console, Cmd_DumpMasks));
+	registerCmd("faceCache",			WRAP_METHOD(Console, Cmd_FaceCache));
 }
 
 Console::~Console() {
@@ -455,6 +457,36 @@ bool Console::Cmd_DumpMasks(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_FaceCache(int argc, const char **argv) {
+	bool clear = argc == 2 && strcmp(argv[1], "clear") == 0;
+	bool budget = argc == 3 && strcmp(argv[1], "budget") == 0;
+	if (argc > 1 && !clear && !budget) {
+		debugPrintf("Usage :\n");
+		debugPrintf("faceCache [clear | budget <MB>]\n");
+		return true;
+	}
+
+	if (budget) {
+		_vm->_faceCache->setBudget(atoi(argv[2]));
+	}
+
+	const FaceCache::Stats &stats = _vm->_faceCache->getStats();
+	uint32 lookups = stats.hits + stats.misses;
+
+	debugPrintf("Cached faces: %d / %d (%d MB), queued: %d\n", _vm->_faceCache->getSize(),
+			_vm->_faceCache->getMaxSize(), _vm->_faceCache->getBudget(), _vm->_faceCache->getQueueSize());
+	debugPrintf("Hits: %d, misses: %d (%d%% hit rate)\n", stats.hits, stats.misses,
+			lookups ? stats.hits * 100 / lookups : 0);
+	debugPrintf("Preloaded: %d, evicted: %d\n", stats.preloaded, stats.evictions);
+
+	if (clear) {
+		_vm->_faceCache->clear();
+		_vm->_faceCache->resetStats();
+	}
+
+	return true;
+}
+
 bool Console::dumpFaceMask(uint16 index, int face, Archive::ResourceType type) {
 	ResourceDescription maskDesc = _vm->getFileDescription("", index, face, type);
 
@@ -0,0 +1,226 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/myst3/facecache.h"
+#include "engines/myst3/archive.h"
+#include "engines/myst3/database.h"
+#include "engines/myst3/myst3.h"
+#include "engines/myst3/state.h"
+
+#include "common/system.h"
+
+#include "graphics/surface.h"
+
+namespace Myst3 {
+
+FaceCache::FaceCache(Myst3Engine *vm, int budgetMB) :
+		_vm(vm),
+		_budgetMB(0),
+		_maxFaces(0),
+		_decodeTime(0) {
+	resetStats();
+	setBudget(budgetMB);
+}
+
+FaceCache::~FaceCache() {
+	clear();
+}
+
+void FaceCache::clear() {
+	for (Common::List<Entry>::iterator it = _entries.begin(); it != _entries.end(); it++) {
+		it->bitmap->free();
+		delete it->bitmap;
+	}
+
+	_entries.clear();
+	_queue.clear();
+}
+
+void FaceCache::setBudget(int budgetMB) {
+	_budgetMB = CLIP(budgetMB, 0, 1024);
+	// Always keep the face that was decoded last, it is handed out by getFace
+	_maxFaces = MAX<uint>(_budgetMB * 1024 * 1024 / kFaceSize, 1);
+	evict();
+}
+
+void FaceCache::evict() {
+	while (_entries.size() > _maxFaces) {
+		Entry &oldest = _entries.back();
+		oldest.bitmap->free();
+		delete oldest.bitmap;
+		_entries.pop_back();
+		_stats.evictions++;
+	}
+}
+
+void FaceCache::resetStats() {
+	_stats.hits = 0;
+	_stats.misses = 0;
+	_stats.preloaded = 0;
+	_stats.evictions = 0;
+}
+
+Common::String FaceCache::getCurrentRoomName() const {
+	return _vm->_db->getRoomName(_vm->_state->getLocationRoom(), _vm->_state->getLocationAge());
+}
+
+Common::List<FaceCache::Entry>::iterator FaceCache::find(const Common::String &room, uint16 nodeID, uint16 face) {
+	Common::List<Entry>::iterator it = _entries.begin();
+	while (it != _entries.end()) {
+		if (it->node == nodeID && it->face == face && it->room == room)
+			break;
+		it++;
+	}
+
+	return it;
+}
+
+void FaceCache::insert(const Common::String &room, uint16 nodeID, uint16 face, Graphics::Surface *bitmap) {
+	Entry entry;
+	entry.room = room;
+	entry.node = nodeID;
+	entry.face = face;
+	entry.bitmap = bitmap;
+	_entries.push_front(entry);
+
+	evict();
+}
+
+Graphics::Surface *FaceCache::getFace(uint16 nodeID, uint16 face, const ResourceDescription &jpegDesc) {
+	Common::String room = getCurrentRoomName();
+
+	Common::List<Entry>::iterator it = find(room, nodeID, face);
+	if (it != _entries.end()) {
+		_stats.hits++;
+
+		// Move to the front of the list
+		Entry entry = *it;
+		_entries.erase(it);
+		_entries.push_front(entry);
+	} else {
+		_stats.misses++;
+
+		insert(room, nodeID, face, Myst3Engine::decodeJpeg(&jpegDesc));
+	}
+
+	// The node draws spot items onto its faces, hand out a copy
+	Graphics::Surface *bitmap = new Graphics::Surface();
+	bitmap->copyFrom(*_entries.front().bitmap);
+	return bitmap;
+}
+
+void FaceCache::queueAdjacentNodes(uint16 nodeID) {
+	_queue.clear();
+	_queueRoom = getCurrentRoomName();
+
+	NodePtr nodeData = _vm->_db->getNodeData(nodeID, _vm->_state->getLocationRoom(), _vm->_state->getLocationAge());
+	if (!nodeData)
+		return;
+
+	for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+		const Common::Array<Opcode> &script = nodeData->hotspots[i].script;
+
+		for (uint j = 0; j < script.size(); j++) {
+			switch (script[j].op) {
+			case 136: // goToNodeTransition
+			case 137: // goToNodeTrans2
+			case 138: // goToNodeTrans1
+			case 164: // changeNode
+				if (!script[j].args.empty()) {
+					int32 target = _vm->_state->valueOrVarValue(script[j].args[0]);
+					if (target > 0 && target != nodeID)
+						queueNode(target);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
+
+void FaceCache::queueNode(uint16 nodeID) {
+	// Leave room for the faces of the current node, so preloading
+	// never evicts them
+	if (_queue.size() + 12 > _maxFaces)
+		return;
+
+	for (Common::List<PendingFace>::iterator it = _queue.begin(); it != _queue.end(); it++) {
+		if (it->node == nodeID)
+			return;
+	}
+
+	for (uint16 face = 1; face <= 6; face++) {
+		PendingFace pending;
+		pending.node = nodeID;
+		pending.face = face;
+		_queue.push_back(pending);
+	}
+}
+
+void FaceCache::preloadFaces(uint32 timeLeft) {
+	if (!_queue.empty() && _decodeTime > timeLeft) {
+		// Forget about a slow decode over time, so that a single one
+		// does not stop preloading for good
+		_decodeTime--;
+		return;
+	}
+
+	uint32 startTime = g_system->getMillis();
+
+	while (!_queue.empty() && g_system->getMillis() - startTime + _decodeTime <= timeLeft) {
+		preloadStep();
+	}
+}
+
+void FaceCache::preloadStep() {
+	if (_queue.empty())
+		return;
+
+	PendingFace pending = _queue.front();
+	_queue.pop_front();
+
+	Common::String room = getCurrentRoomName();
+	if (room != _queueRoom) {
+		// The queue was built for another room
+		_queue.clear();
+		return;
+	}
+
+	if (find(room, pending.node, pending.face) != _entries.end())
+		return;
+
+	ResourceDescription jpegDesc = _vm->getFileDescription("", pending.node, pending.face, Archive::kCubeFace);
+	if (!jpegDesc.isValid()) {
+		// Not a cube node, drop its other faces too
+		while (!_queue.empty() && _queue.front().node == pending.node)
+			_queue.pop_front();
+		return;
+	}
+
+	uint32 decodeStartTime = g_system->getMillis();
+	insert(room, pending.node, pending.face, Myst3Engine::decodeJpeg(&jpegDesc));
+	_decodeTime = g_system->getMillis() - decodeStartTime;
+	_stats.preloaded++;
+}
+
+} // End of namespace Myst3
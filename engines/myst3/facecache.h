@@ -0,0 +1,123 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef FACECACHE_H_
+#define FACECACHE_H_
+
+#include "common/list.h"
+#include "common/str.h"
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Myst3 {
+
+class Myst3Engine;
+class ResourceDescription;
+
+/**
+ * Keeps recently decoded cube faces around, and decodes the faces of the
+ * nodes reachable from the current node ahead of time, one face per frame,
+ * so moving to a neighbouring node does not stall on JPEG decoding.
+ */
+class FaceCache {
+public:
+	struct Stats {
+		uint32 hits;
+		uint32 misses;
+		uint32 preloaded;
+		uint32 evictions;
+	};
+
+	/** Memory used by a decoded cube face, 640x640 pixels in RGBA */
+	static const uint32 kFaceSize = 640 * 640 * 4;
+
+	FaceCache(Myst3Engine *vm, int budgetMB);
+	~FaceCache();
+
+	/** Set how much memory the cached faces may use, evicting faces as needed */
+	void setBudget(int budgetMB);
+	uint getBudget() const { return _budgetMB; }
+
+	/**
+	 * Decode a face of a cube node from the current room
+	 *
+	 * The returned surface is owned by the caller.
+	 */
+	Graphics::Surface *getFace(uint16 nodeID, uint16 face, const ResourceDescription &jpegDesc);
+
+	/** Replace the preload queue with the faces of the nodes the hotspots of a node lead to */
+	void queueAdjacentNodes(uint16 nodeID);
+
+	/**
+	 * Decode queued faces for as long as the expected decoding time fits
+	 * into the given time
+	 */
+	void preloadFaces(uint32 timeLeft);
+
+	void clear();
+
+	uint getSize() const { return _entries.size(); }
+	uint getMaxSize() const { return _maxFaces; }
+	uint getQueueSize() const { return _queue.size(); }
+	const Stats &getStats() const { return _stats; }
+	void resetStats();
+
+private:
+	struct Entry {
+		Common::String room;
+		uint16 node;
+		uint16 face;
+		Graphics::Surface *bitmap;
+	};
+
+	struct PendingFace {
+		uint16 node;
+		uint16 face;
+	};
+
+	Myst3Engine *_vm;
+	uint _budgetMB;
+	uint _maxFaces;
+
+	// Time it took to decode the last preloaded face, in ms
+	uint32 _decodeTime;
+
+	// Most recently used first
+	Common::List<Entry> _entries;
+	Common::List<PendingFace> _queue;
+	Common::String _queueRoom;
+
+	Stats _stats;
+
+	Common::String getCurrentRoomName() const;
+	Common::List<Entry>::iterator find(const Common::String &room, uint16 nodeID, uint16 face);
+	void insert(const Common::String &room, uint16 nodeID, uint16 face, Graphics::Surface *bitmap);
+	void queueNode(uint16 nodeID);
+	void evict();
+	void preloadStep();
+};
+
+} // End of namespace Myst3
+
+#endif // FACECACHE_H_
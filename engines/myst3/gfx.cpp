@@ -330,6 +330,14 @@ void FrameLimiter::delayBeforeSwap() {
 	}
 }
 
+uint FrameLimiter::getTimeLeft() const {
+	// Without a limit, assume vsync at 60 Hz
+	uint frameLength = _enabled ? _speedLimitMs : 1000 / 60;
+	uint frameDuration = _system->getMillis() - _startFrameTime;
+
+	return frameDuration < frameLength ? frameLength - frameDuration : 0;
+}
+
 const Graphics::PixelFormat Texture::getRGBAPixelFormat() {
 #ifdef SCUMM_BIG_ENDIAN
 	return Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
@@ -209,6 +209,9 @@ public:
 
 	void startFrame();
 	void delayBeforeSwap();
+
+	/** Get the time in ms left until the frame being drawn is due */
+	uint getTimeLeft() const;
 private:
 	OSystem *_system;
 
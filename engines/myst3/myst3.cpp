@@ -38,6 +38,7 @@
 #include "engines/myst3/console.h"
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/myst3.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/nodeframe.h"
@@ -67,7 +68,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		_db(0), _scriptEngine(0),
 		_state(0), _node(0), _scene(0), _archiveNode(0),
 		_cursor(0), _inventory(0), _gfx(0), _menu(0),
-		_rnd(0), _sound(0), _ambient(0),
+		_rnd(0), _sound(0), _ambient(0), _faceCache(0),
 		_inputSpacePressed(false), _inputEnterPressed(false),
 		_inputEscapePressed(false), _inputTildePressed(false),
 		_inputEscapePressedNotConsumed(false),
@@ -119,6 +120,7 @@ Myst3Engine::~Myst3Engine() {
 	delete _inventory;
 	delete _cursor;
 	delete _scene;
+	delete _faceCache;
 	delete _archiveNode;
 	delete _db;
 	delete _scriptEngine;
@@ -173,6 +175,7 @@ Common::Error Myst3Engine::run() {
 	_system->showMouse(false);
 
 	settingsInitDefaults();
+	_faceCache = new FaceCache(this, ConfMan.getInt("face_cache_size"));
 	syncSoundSettings();
 	openArchives();
 
@@ -755,6 +758,9 @@ void Myst3Engine::drawFrame(bool noSwap) {
 	_gfx->flipBuffer();
 
 	if (!noSwap) {
+		// Use the time left in the frame to get the next nodes ready
+		_faceCache->preloadFaces(_frameLimiter->getTimeLeft());
+
 		_frameLimiter->delayBeforeSwap();
 		_system->updateScreen();
 		_state->updateFrameCounters();
@@ -958,6 +964,8 @@ void Myst3Engine::loadNodeCubeFaces(uint16 nodeID) {
 	updateCursor();
 
 	_node = new NodeCube(this, nodeID);
+
+	_faceCache->queueAdjacentNodes(nodeID);
 }
 
 void Myst3Engine::loadNodeFrame(uint16 nodeID) {
@@ -1848,6 +1856,8 @@ void Myst3Engine::settingsInitDefaults() {
 	ConfMan.registerDefault("zip_mode", false);
 	ConfMan.registerDefault("subtitles", false);
 	ConfMan.registerDefault("vibrations", true); // Xbox specific
+	// Memory for decoded cube faces in MB, 48 MB holds the current node and four neighbours
+	ConfMan.registerDefault("face_cache_size", 48);
 }
 
 void Myst3Engine::settingsLoadToVars() {
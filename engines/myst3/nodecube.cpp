@@ -21,6 +21,7 @@
  */
 
 #include "engines/myst3/archive.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/myst3.h"
 
@@ -39,7 +40,7 @@ NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 			error("Face %d does not exist", id);
 
 		_faces[i] = new Face(_vm);
-		_faces[i]->setTextureFromJPEG(&jpegDesc);
+		_faces[i]->setTextureFromBitmap(_vm->_faceCache->getFace(id, i + 1, jpegDesc));
 	}
 }
 
@@ -73,6 +73,8 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
 	_offsetLookupSaidCount = 0;
+
+	invalidateDecodedInstructions();
 }
 
 enum {
@@ -1275,4 +1277,28 @@ bool Script::offsetIsObject(uint32 offset) const {
 	return _buf->getUint16SEAt(offset + SCRIPT_OBJECT_MAGIC_OFFSET) == SCRIPT_OBJECT_MAGIC_NUMBER;
 }
 
+const DecodedInstruction &Script::getDecodedInstruction(uint32 offset) {
+	// Only the script block is cached, the SCI1.1 - SCI2.1 heap never
+	// contains code
+	if (offset >= _script.size()) {
+		_uncachedInstruction.size = readPMachineInstruction(getBuf(offset), _uncachedInstruction.extOpcode, _uncachedInstruction.opparams);
+		return _uncachedInstruction;
+	}
+
+	if (_decodedInstructions.empty())
+		_decodedInstructions.resize(_script.size());
+
+	DecodedInstruction &instruction = _decodedInstructions[offset];
+	if (!instruction.size) {
+		instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.opparams);
+		_decodedInstructionCount++;
+	}
+	return instruction;
+}
+
+void Script::invalidateDecodedInstructions() {
+	_decodedInstructions.clear();
+	_decodedInstructionCount = 0;
+}
+
 } // End of namespace Sci
@@ -69,6 +69,18 @@ struct offsetLookupArrayEntry {
 
 typedef Common::Array<offsetLookupArrayEntry> offsetLookupArrayType;
 
+/**
+ * A PMachine instruction with its operands already decoded, as returned by
+ * readPMachineInstruction.
+ */
+struct DecodedInstruction {
+	int16 opparams[4]; /**< Decoded opcode parameters */
+	uint16 size;       /**< Size of the instruction in bytes, including operands */
+	byte extOpcode;    /**< Extended opcode (lower bit selects the operand size) */
+};
+
+typedef Common::Array<DecodedInstruction> DecodedInstructionArray;
+
 class Script : public SegmentObj {
 private:
 	int _nr; /**< Script number */
@@ -102,6 +114,22 @@ private:
 	uint16 _offsetLookupStringCount;
 	uint16 _offsetLookupSaidCount;
 
+	/**
+	 * Instructions of this script that have been decoded by the VM so far,
+	 * indexed by their offset in the script block. A size of 0 means that
+	 * the instruction at that offset has not been decoded yet. Allocated on
+	 * first use, so scripts that are never executed don't pay for it.
+	 */
+	DecodedInstructionArray _decodedInstructions;
+
+	/** Number of decoded entries in _decodedInstructions. */
+	uint _decodedInstructionCount;
+
+	/**
+	 * Scratch entry for instructions outside of the script block.
+	 */
+	DecodedInstruction _uncachedInstruction;
+
 public:
 	int getLocalsOffset() const { return _localsOffset; }
 	uint16 getLocalsCount() const { return _localsCount; }
@@ -288,6 +316,27 @@ public:
 	uint16 getOffsetStringCount() { return _offsetLookupStringCount; };
 	uint16 getOffsetSaidCount() { return _offsetLookupSaidCount; };
 
+	/**
+	 * Returns the decoded instruction at the given offset of the script. The
+	 * instruction is decoded on first use and cached afterwards, so that the
+	 * VM does not have to go through the opcode format table each time the
+	 * same code is executed.
+	 * @param offset	The offset of the instruction inside the script buffer
+	 */
+	const DecodedInstruction &getDecodedInstruction(uint32 offset);
+
+	/**
+	 * Drops all cached decoded instructions. Must be called whenever the
+	 * code of the script gets modified after it has been executed.
+	 */
+	void invalidateDecodedInstructions();
+
+	/**
+	 * Returns the number of instructions currently held in the decoded
+	 * instruction cache.
+	 */
+	uint getDecodedInstructionCount() const { return _decodedInstructionCount; }
+
 	/**
 	 * @returns kNoRelocation if no relocation exists for the given offset,
 	 * otherwise returns a delta for the offset to its relocated position.
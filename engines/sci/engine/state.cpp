@@ -176,6 +176,7 @@ uint16 EngineState::currentRoomNumber() const {
 
 void EngineState::setRoomNumber(uint16 roomNumber) {
 	variables[VAR_GLOBAL][kGlobalVarNewRoomNo] = make_reg(0, roomNumber);
+	g_sci->getResMan()->setPinnedRoom(roomNumber);
 }
 
 void EngineState::shrinkStackToBase() {
@@ -202,6 +202,10 @@ static void write_var(EngineState *s, int type, int index, reg_t value) {
 
 		s->variables[type][index] = value;
 
+		// Keep the resources of the room being entered in memory
+		if (type == VAR_GLOBAL && index == kGlobalVarNewRoomNo)
+			g_sci->getResMan()->setPinnedRoom(value.toUint16());
+
 		g_sci->_guestAdditions->writeVarHook(type, index, value);
 	}
 }
@@ -664,9 +668,13 @@ void run_vm(EngineState *s) {
 
 		// Get opcode
 		byte extOpcode;
-		if (!vmHooks.isActive(s))
-			s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
-		else {
+		if (!vmHooks.isActive(s)) {
+			// Operands are decoded only once per script, see Script::getDecodedInstruction
+			const DecodedInstruction &instruction = scr->getDecodedInstruction(s->xs->addr.pc.getOffset());
+			extOpcode = instruction.extOpcode;
+			memcpy(opparams, instruction.opparams, sizeof(opparams));
+			s->xs->addr.pc.incOffset(instruction.size);
+		} else {
 			int offset = readPMachineInstruction(vmHooks.data(), extOpcode, opparams);
 			vmHooks.advance(offset);
 		}
@@ -92,11 +92,16 @@ void CelObj::init() {
 	_nextCacheId = 1;
 	_scaler.reset(new CelScaler());
 	_cache.reset(new CelCache(100));
+	_pixelCache.reset(new CelPixelCache());
+	_pixelCacheSize = 0;
+	_pixelCacheStats = CelPixelCacheStats();
 }
 
 void CelObj::deinit() {
 	_scaler.reset();
 	_cache.reset();
+	_pixelCache.reset();
+	_pixelCacheSize = 0;
 }
 
 #pragma mark -
@@ -351,18 +356,22 @@ struct READER_Compressed {
 private:
 	const SciSpan<const byte> _resource;
 	byte _buffer[kCelScalerTableSize];
+	const byte *_pixels;
 	uint32 _controlOffset;
 	uint32 _dataOffset;
 	uint32 _uncompressedDataOffset;
 	int16 _y;
+	const int16 _sourceWidth;
 	const int16 _sourceHeight;
 	const uint8 _skipColor;
 	const int16 _maxWidth;
 
 public:
-	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
+	READER_Compressed(const CelObj &celObj, const int16 maxWidth, const bool useCache = true) :
 	_resource(celObj.getResPointer()),
+	_pixels(useCache ? celObj.getDecodedPixels() : nullptr),
 	_y(-1),
+	_sourceWidth(celObj._width),
 	_sourceHeight(celObj._height),
 	_skipColor(celObj._skipColor),
 	_maxWidth(maxWidth) {
@@ -376,6 +385,10 @@ public:
 
 	inline const byte *getRow(const int16 y) {
 		assert(y >= 0 && y < _sourceHeight);
+		if (_pixels) {
+			return _pixels + y * _sourceWidth;
+		}
+
 		if (y != _y) {
 			// compressed data segment for row
 			const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
@@ -687,6 +700,17 @@ void CelObj::submitPalette() const {
 
 int CelObj::_nextCacheId = 1;
 Common::ScopedPtr<CelCache> CelObj::_cache;
+Common::ScopedPtr<CelPixelCache> CelObj::_pixelCache;
+uint32 CelObj::_pixelCacheSize = 0;
+CelPixelCacheStats CelObj::_pixelCacheStats;
+
+enum {
+	/**
+	 * The maximum number of bytes of decompressed pixels kept in the decoded
+	 * cel cache.
+	 */
+	kCelPixelCacheMaxSize = 16 * 1024 * 1024
+};
 
 int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
 	*nextInsertIndex = -1;
@@ -726,6 +750,66 @@ void CelObj::putCopyInCache(const int cacheIndex) const {
 	entry.id = ++_nextCacheId;
 }
 
+const byte *CelObj::getDecodedPixels() const {
+	if (!_pixelCache || _compressionType != kCelCompressionRLE ||
+		(_info.type != kCelTypeView && _info.type != kCelTypePic)) {
+		return nullptr;
+	}
+
+	const uint32 size = _width * _height;
+
+	// Very large cels would evict everything else and are unlikely to be drawn
+	// many times anyway
+	if (size == 0 || size > kCelPixelCacheMaxSize / 4) {
+		return nullptr;
+	}
+
+	CelPixelCacheKey key;
+	key.type = _info.type;
+	key.resourceId = _info.resourceId;
+	key.loopNo = _info.loopNo;
+	key.celNo = _info.celNo;
+
+	CelPixelCache::iterator it = _pixelCache->find(key);
+	if (it != _pixelCache->end()) {
+		++_pixelCacheStats.hits;
+		it->_value.id = ++_nextCacheId;
+		return it->_value.pixels.begin();
+	}
+
+	++_pixelCacheStats.misses;
+	makeRoomInPixelCache(size);
+
+	CelPixelCacheEntry &entry = (*_pixelCache)[key];
+	entry.id = ++_nextCacheId;
+	entry.pixels.resize(size);
+
+	READER_Compressed reader(*this, _width, false);
+	byte *pixel = entry.pixels.begin();
+	for (int16 y = 0; y < _height; ++y) {
+		memcpy(pixel, reader.getRow(y), _width);
+		pixel += _width;
+	}
+
+	_pixelCacheSize += size;
+	return entry.pixels.begin();
+}
+
+void CelObj::makeRoomInPixelCache(const uint32 size) {
+	while (_pixelCacheSize + size > kCelPixelCacheMaxSize && !_pixelCache->empty()) {
+		CelPixelCache::iterator oldest = _pixelCache->begin();
+		for (CelPixelCache::iterator it = _pixelCache->begin(); it != _pixelCache->end(); ++it) {
+			if (it->_value.id < oldest->_value.id) {
+				oldest = it;
+			}
+		}
+
+		_pixelCacheSize -= oldest->_value.pixels.size();
+		++_pixelCacheStats.evictions;
+		_pixelCache->erase(oldest);
+	}
+}
+
 #pragma mark -
 #pragma mark CelObj - Drawing
 
@@ -789,6 +873,34 @@ void CelObj::render(Buffer &target, const Common::Rect &targetRect, const Common
 	}
 }
 
+template<typename READER, bool SKIP>
+void CelObj::renderSpans(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
+	READER reader(*this, targetRect.left - scaledPosition.x + targetRect.width());
+
+	byte *targetPixel = (byte *)target.getPixels() + target.w * targetRect.top + targetRect.left;
+	const int16 sourceX = targetRect.left - scaledPosition.x;
+	const int16 sourceY = targetRect.top - scaledPosition.y;
+	const int16 targetWidth = targetRect.width();
+	const int16 targetHeight = targetRect.height();
+	const uint8 skipColor = _skipColor;
+
+	for (int16 y = 0; y < targetHeight; ++y) {
+		const byte *sourcePixel = reader.getRow(sourceY + y) + sourceX;
+
+		if (SKIP) {
+			// Unconditional store so that this loop can be vectorised
+			for (int16 x = 0; x < targetWidth; ++x) {
+				const byte pixel = sourcePixel[x];
+				targetPixel[x] = (pixel != skipColor) ? pixel : targetPixel[x];
+			}
+		} else {
+			memcpy(targetPixel, sourcePixel, targetWidth);
+		}
+
+		targetPixel += target.w;
+	}
+}
+
 void CelObj::drawHzFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
 	render<MAPPER_NoMap, SCALER_NoScale<true, READER_Compressed> >(target, targetRect, scaledPosition);
 }
@@ -854,7 +966,11 @@ void CelObj::scaleDrawUncompMap(Buffer &target, const Ratio &scaleX, const Ratio
 }
 
 void CelObj::drawNoFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
-	render<MAPPER_NoMD, SCALER_NoScale<false, READER_Compressed> >(target, targetRect, scaledPosition);
+	if (_isMacSource) {
+		render<MAPPER_NoMD, SCALER_NoScale<false, READER_Compressed> >(target, targetRect, scaledPosition);
+	} else {
+		renderSpans<READER_Compressed, true>(target, targetRect, scaledPosition);
+	}
 }
 
 void CelObj::drawHzFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
@@ -862,11 +978,19 @@ void CelObj::drawHzFlipNoMD(Buffer &target, const Common::Rect &targetRect, cons
 }
 
 void CelObj::drawUncompNoFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
-	render<MAPPER_NoMD, SCALER_NoScale<false, READER_Uncompressed> >(target, targetRect, scaledPosition);
+	if (_isMacSource) {
+		render<MAPPER_NoMD, SCALER_NoScale<false, READER_Uncompressed> >(target, targetRect, scaledPosition);
+	} else {
+		renderSpans<READER_Uncompressed, true>(target, targetRect, scaledPosition);
+	}
 }
 
 void CelObj::drawUncompNoFlipNoMDNoSkip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
-	render<MAPPER_NoMDNoSkip, SCALER_NoScale<false, READER_Uncompressed> >(target, targetRect, scaledPosition);
+	if (_isMacSource) {
+		render<MAPPER_NoMDNoSkip, SCALER_NoScale<false, READER_Uncompressed> >(target, targetRect, scaledPosition);
+	} else {
+		renderSpans<READER_Uncompressed, false>(target, targetRect, scaledPosition);
+	}
 }
 
 void CelObj::drawUncompHzFlipNoMD(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const {
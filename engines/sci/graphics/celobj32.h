@@ -151,6 +151,60 @@ struct CelCacheEntry {
 
 typedef Common::Array<CelCacheEntry> CelCache;
 
+/**
+ * Identifies a compressed view or pic cel in the decoded cel cache.
+ */
+struct CelPixelCacheKey {
+	CelType type;
+	GuiResourceId resourceId;
+	int16 loopNo;
+	int16 celNo;
+
+	inline bool operator==(const CelPixelCacheKey &other) const {
+		return (
+			type == other.type &&
+			resourceId == other.resourceId &&
+			loopNo == other.loopNo &&
+			celNo == other.celNo
+		);
+	}
+};
+
+struct CelPixelCacheKeyHash : public Common::UnaryFunction<CelPixelCacheKey, uint> {
+	uint operator()(const CelPixelCacheKey &key) const {
+		return (key.type << 28) ^ (key.resourceId << 12) ^ (key.loopNo << 8) ^ key.celNo;
+	}
+};
+
+struct CelPixelCacheEntry {
+	/**
+	 * The cache ID of the last use of this entry, taken from the same
+	 * sequence as CelCacheEntry::id.
+	 */
+	int id;
+
+	/**
+	 * The decompressed pixels of the cel, `_width * _height` bytes.
+	 */
+	Common::Array<byte> pixels;
+
+	CelPixelCacheEntry() : id(0) {}
+};
+
+typedef Common::HashMap<CelPixelCacheKey, CelPixelCacheEntry, CelPixelCacheKeyHash> CelPixelCache;
+
+/**
+ * Statistics about the decoded cel cache, shown by the `cel_cache` debugger
+ * command.
+ */
+struct CelPixelCacheStats {
+	uint32 hits;
+	uint32 misses;
+	uint32 evictions;
+
+	CelPixelCacheStats() : hits(0), misses(0), evictions(0) {}
+};
+
 #pragma mark -
 #pragma mark CelScaler
 
@@ -423,6 +477,14 @@ private:
 	template<typename MAPPER, typename SCALER>
 	void render(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition, const Ratio &scaleX, const Ratio &scaleY) const;
 
+	/**
+	 * Draws an unscaled, unmirrored cel without remapping one row span at a
+	 * time, which lets the compiler vectorise the copy. Mac sources need
+	 * their colors translated and must use `render` instead.
+	 */
+	template<typename READER, bool SKIP>
+	void renderSpans(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
+
 	void drawHzFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
 	void drawNoFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
 	void drawUncompNoFlip(Buffer &target, const Common::Rect &targetRect, const Common::Point &scaledPosition) const;
@@ -477,6 +539,38 @@ protected:
 	 * Puts a copy of this CelObj into the cache at the given cache index.
 	 */
 	void putCopyInCache(int index) const;
+
+	/**
+	 * A cache of decompressed pixel data for compressed view and pic cels,
+	 * so that cels which are drawn over and over again do not have to be
+	 * decompressed row by row on every draw.
+	 */
+	static Common::ScopedPtr<CelPixelCache> _pixelCache;
+
+	/**
+	 * The total number of pixel bytes currently held by the decoded cel cache.
+	 */
+	static uint32 _pixelCacheSize;
+
+	static CelPixelCacheStats _pixelCacheStats;
+
+	/**
+	 * Frees least recently used entries from the decoded cel cache until
+	 * `size` additional bytes fit into its memory budget.
+	 */
+	static void makeRoomInPixelCache(uint32 size);
+
+public:
+	/**
+	 * Returns the decompressed pixels of this cel from the decoded cel cache,
+	 * decompressing the cel into the cache first if necessary. Returns null
+	 * if the cel is not compressed or is too large to be cached.
+	 */
+	const byte *getDecodedPixels() const;
+
+	static const CelPixelCacheStats &getPixelCacheStats() { return _pixelCacheStats; }
+	static uint32 getPixelCacheSize() { return _pixelCacheSize; }
+	static uint getPixelCacheEntryCount() { return _pixelCache ? _pixelCache->size() : 0; }
 };
 
 #pragma mark -
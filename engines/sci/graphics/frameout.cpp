@@ -518,7 +518,7 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 	_palette->updateHardware();
 
 	if (shouldShowBits) {
-		showBits();
+		showBits(true);
 	}
 
 	if (robotIsActive) {
@@ -594,7 +594,7 @@ void GfxFrameout::palMorphFrameOut(const int8 *styleRanges, PlaneShowStyle *show
 	if (showStyle && showStyle->type != kShowStyleMorph) {
 		_transitions->processEffects(*showStyle);
 	} else {
-		showBits();
+		showBits(true);
 	}
 
 	for (PlaneList::iterator plane = _planes.begin(); plane != _planes.end(); ++plane) {
@@ -626,7 +626,7 @@ void GfxFrameout::palMorphFrameOut(const int8 *styleRanges, PlaneShowStyle *show
 	_palette->submit(nextPalette);
 	_palette->updateFFrame();
 	_palette->updateHardware();
-	showBits();
+	showBits(true);
 }
 
 void GfxFrameout::directFrameOut(const Common::Rect &showRect) {
@@ -1068,41 +1068,49 @@ void GfxFrameout::mergeToShowList(const Common::Rect &drawRect, RectList &showLi
 	}
 }
 
-void GfxFrameout::showBits() {
+void GfxFrameout::showBits(const bool coalesceRects) {
 	if (!_showList.size()) {
 		updateScreen();
 		return;
 	}
 
+	Common::Array<Common::Rect> showRects;
+	showRects.reserve(_showList.size());
 	for (RectList::const_iterator rect = _showList.begin(); rect != _showList.end(); ++rect) {
 		Common::Rect rounded(**rect);
 		// SSCI uses BR-inclusive rects so has slightly different masking here
 		// to ensure that the width of rects is always even
 		rounded.left &= ~1;
 		rounded.right = (rounded.right + 1) & ~1;
-		_cursor->gonnaPaint(rounded);
+		showRects.push_back(rounded);
 	}
 
-	_cursor->paintStarting();
+	if (coalesceRects) {
+		coalesceShowRects(showRects);
+	}
 
-	for (RectList::const_iterator rect = _showList.begin(); rect != _showList.end(); ++rect) {
-		Common::Rect rounded(**rect);
-		// SSCI uses BR-inclusive rects so has slightly different masking here
-		// to ensure that the width of rects is always even
-		rounded.left &= ~1;
-		rounded.right = (rounded.right + 1) & ~1;
+	// Sometimes screen items (especially from SCI2.1early transitions, like
+	// in the asteroids minigame in PQ4) generate zero-dimension show
+	// rectangles. In SSCI, zero-dimension rectangles are OK (they just result
+	// in no copy), but OSystem::copyRectToScreen will assert on them, so they
+	// are dropped here along with any rects which got merged
+	for (uint i = 0; i < showRects.size(); ) {
+		if (showRects[i].isEmpty()) {
+			showRects.remove_at(i);
+		} else {
+			++i;
+		}
+	}
 
-		byte *sourceBuffer = (byte *)_currentBuffer.getPixels() + rounded.top * _currentBuffer.w + rounded.left;
+	for (Common::Array<Common::Rect>::const_iterator rect = showRects.begin(); rect != showRects.end(); ++rect) {
+		_cursor->gonnaPaint(*rect);
+	}
 
-		// Sometimes screen items (especially from SCI2.1early transitions, like
-		// in the asteroids minigame in PQ4) generate zero-dimension show
-		// rectangles. In SSCI, zero-dimension rectangles are OK (they just
-		// result in no copy), but OSystem::copyRectToScreen will assert on
-		// them, so we need to check for zero-dimensions rectangles and ignore
-		// them explicitly
-		if (rounded.width() == 0 || rounded.height() == 0) {
-			continue;
-		}
+	_cursor->paintStarting();
+
+	for (Common::Array<Common::Rect>::const_iterator rect = showRects.begin(); rect != showRects.end(); ++rect) {
+		const Common::Rect &rounded = *rect;
+		byte *sourceBuffer = (byte *)_currentBuffer.getPixels() + rounded.top * _currentBuffer.w + rounded.left;
 
 #ifdef USE_RGB_COLOR
 		if (g_system->getScreenFormat() != _currentBuffer.format) {
@@ -1127,6 +1135,47 @@ void GfxFrameout::showBits() {
 	updateScreen();
 }
 
+void GfxFrameout::coalesceShowRects(Common::Array<Common::Rect> &rects) const {
+	// Number of pixels which are cheaper to copy again than to send to the
+	// backend in a separate blit
+	const int kBlitOverhead = 320;
+
+	bool didMerge;
+	do {
+		didMerge = false;
+		for (uint i = 0; i < rects.size(); ++i) {
+			if (rects[i].isEmpty()) {
+				continue;
+			}
+
+			for (uint j = i + 1; j < rects.size(); ++j) {
+				const Common::Rect &r1 = rects[i];
+				const Common::Rect &r2 = rects[j];
+				if (r2.isEmpty()) {
+					continue;
+				}
+
+				Common::Rect merged(r1);
+				merged.extend(r2);
+
+				int difference = merged.width() * merged.height();
+				difference -= r1.width() * r1.height();
+				difference -= r2.width() * r2.height();
+				if (r1.intersects(r2)) {
+					const Common::Rect overlap = r1.findIntersectingRect(r2);
+					difference += overlap.width() * overlap.height();
+				}
+
+				if (difference <= kBlitOverhead) {
+					rects[i] = merged;
+					rects[j] = Common::Rect();
+					didMerge = true;
+				}
+			}
+		}
+	} while (didMerge);
+}
+
 void GfxFrameout::alterVmap(const Palette &palette1, const Palette &palette2, const int8 style, const int8 *const styleRanges) {
 	uint8 clut[256];
 
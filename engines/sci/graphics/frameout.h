@@ -379,8 +379,21 @@ private:
 	/**
 	 * Sends all dirty rects from the internal frame buffer to the backend, then
 	 * updates the hardware screen.
+	 *
+	 * @param coalesceRects If true, neighbouring rects are merged before
+	 * being sent, see coalesceShowRects. This must only be used when the
+	 * whole frame buffer is ready to be shown; transitions reveal the buffer
+	 * piece by piece and rely on exactly their rects being sent.
+	 */
+	void showBits(const bool coalesceRects = false);
+
+	/**
+	 * Merges rectangles of the given list, which have already been rounded
+	 * for hardware output, when they overlap or when merging them adds less
+	 * overdraw than the overhead of an additional blit. Rectangles which got
+	 * merged into another one are left empty.
 	 */
-	void showBits();
+	void coalesceShowRects(Common::Array<Common::Rect> &rects) const;
 
 	/**
 	 * Validates whether the given palette index in the style range should copy
@@ -211,6 +211,9 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : SciSpan<const byte>
 	_fileOffset = 0;
 	_status = kResStatusNoMalloc;
 	_lockers = 0;
+	_compression = kCompNone;
+	_cachePriority = 0;
+	_cacheSerial = 0;
 	_source = nullptr;
 	_header = nullptr;
 	_headerSize = 0;
@@ -993,6 +996,11 @@ void ResourceManager::init() {
 	_memoryLocked = 0;
 	_memoryLRU = 0;
 	_LRU.clear();
+	_cacheInflation = 0;
+	_cacheQueue.clear();
+	_cacheSerial = 0;
+	_pinnedRoom = -1;
+	_cacheStats = ResourceCacheStats();
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 #ifdef ENABLE_SCI32
@@ -1107,6 +1115,50 @@ ResourceManager::~ResourceManager() {
 	}
 }
 
+static bool cacheEntryLess(const ResourceCacheEntry &a, const ResourceCacheEntry &b) {
+	if (a.priority != b.priority)
+		return a.priority < b.priority;
+	return a.serial < b.serial;
+}
+
+static void pushCacheEntry(Common::Array<ResourceCacheEntry> &heap, const ResourceCacheEntry &entry) {
+	uint i = heap.size();
+	heap.push_back(entry);
+
+	while (i > 0) {
+		const uint parent = (i - 1) / 2;
+		if (!cacheEntryLess(heap[i], heap[parent]))
+			break;
+		SWAP(heap[i], heap[parent]);
+		i = parent;
+	}
+}
+
+static ResourceCacheEntry popCacheEntry(Common::Array<ResourceCacheEntry> &heap) {
+	const ResourceCacheEntry top = heap[0];
+	heap[0] = heap.back();
+	heap.pop_back();
+
+	uint i = 0;
+	for (;;) {
+		const uint left = i * 2 + 1;
+		const uint right = left + 1;
+		uint smallest = i;
+
+		if (left < heap.size() && cacheEntryLess(heap[left], heap[smallest]))
+			smallest = left;
+		if (right < heap.size() && cacheEntryLess(heap[right], heap[smallest]))
+			smallest = right;
+		if (smallest == i)
+			break;
+
+		SWAP(heap[i], heap[smallest]);
+		i = smallest;
+	}
+
+	return top;
+}
+
 void ResourceManager::removeFromLRU(Resource *res) {
 	if (res->_status != kResStatusEnqueued) {
 		warning("resMan: trying to remove resource that isn't enqueued");
@@ -1124,6 +1176,17 @@ void ResourceManager::addToLRU(Resource *res) {
 	}
 	_LRU.push_front(res);
 	_memoryLRU += res->size();
+	res->_cachePriority = getCachePriority(res);
+	res->_cacheSerial = ++_cacheSerial;
+
+	// Resources leaving the queue leave stale entries behind, which are
+	// dropped here once they outnumber the live ones
+	if (_cacheQueue.size() > 2 * _LRU.size() + 64) {
+		rebuildCacheQueue();
+	} else {
+		ResourceCacheEntry entry = { res->_cachePriority, res->_cacheSerial, res->_id };
+		pushCacheEntry(_cacheQueue, entry);
+	}
 #if SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
 	      res->_id.toString().c_str(), res->size,
@@ -1149,16 +1212,117 @@ void ResourceManager::printLRU() {
 	debug("Total: %d entries, %d bytes (mgr says %d)", entries, mem, _memoryLRU);
 }
 
+uint32 ResourceManager::getCachePriority(const Resource *res) const {
+	// Relative cost of unpacking one byte with the resource's compression
+	// method
+	uint32 unpackCost;
+	switch (res->_compression) {
+	case kCompNone:
+		unpackCost = 1;
+		break;
+	case kCompLZW1View:
+	case kCompLZW1Pic:
+		// LZW plus reordering of the unpacked data
+		unpackCost = 6;
+		break;
+	default:
+		unpackCost = 4;
+		break;
+	}
+
+	// Reading any resource has a fixed cost (seeking and parsing its header),
+	// which is counted as if it were this many bytes of uncompressed data
+	const uint32 kLoadCost = 4096;
+
+	const uint32 size = MAX<uint32>(res->size(), 1);
+	return _cacheInflation + (kLoadCost * 16) / size + unpackCost * 16;
+}
+
+Resource *ResourceManager::getQueuedResource(const ResourceCacheEntry &entry) {
+	ResourceMap::iterator it = _resMap.find(entry.id);
+	if (it == _resMap.end())
+		return nullptr;
+
+	Resource *res = it->_value;
+	if (res->_status != kResStatusEnqueued || res->_cacheSerial != entry.serial)
+		return nullptr;
+
+	return res;
+}
+
+void ResourceManager::rebuildCacheQueue() {
+	_cacheQueue.clear();
+	for (Common::List<Resource *>::iterator it = _LRU.begin(); it != _LRU.end(); ++it) {
+		ResourceCacheEntry entry = { (*it)->_cachePriority, (*it)->_cacheSerial, (*it)->_id };
+		pushCacheEntry(_cacheQueue, entry);
+	}
+}
+
 void ResourceManager::freeOldResources() {
+	if (_maxMemoryLRU >= _memoryLRU)
+		return;
+
+	// Resources belonging to the pinned room are set aside while looking for
+	// something to free, and only freed if nothing else is left. They are
+	// collected in priority order.
+	Common::Array<ResourceCacheEntry> pinned;
+	uint nextPinned = 0;
+
 	while (_maxMemoryLRU < _memoryLRU) {
 		assert(!_LRU.empty());
-		Resource *goner = _LRU.back();
-		removeFromLRU(goner);
+
+		// GreedyDual eviction: free the resource with the lowest priority and
+		// raise the priority of everything queued afterwards to its value, so
+		// that resources which are not used any more eventually age out even
+		// if they are expensive to load. Ties are resolved in LRU order.
+		Resource *goner = nullptr;
+		while (!goner && !_cacheQueue.empty()) {
+			const ResourceCacheEntry entry = popCacheEntry(_cacheQueue);
+			Resource *res = getQueuedResource(entry);
+			if (!res)
+				continue;
+
+			if (_pinnedRoom != -1 && res->getNumber() == _pinnedRoom)
+				pinned.push_back(entry);
+			else
+				goner = res;
+		}
+
+		while (!goner && nextPinned < pinned.size())
+			goner = getQueuedResource(pinned[nextPinned++]);
+
+		assert(goner);
+
+		_cacheInflation = MAX(_cacheInflation, goner->_cachePriority);
+		if (_cacheInflation >= 0x80000000) {
+			// Rebase all priorities before they can overflow. The rebuilt
+			// queue includes the resources which were set aside.
+			for (Common::List<Resource *>::iterator it = _LRU.begin(); it != _LRU.end(); ++it)
+				(*it)->_cachePriority -= MIN((*it)->_cachePriority, _cacheInflation);
+			_cacheInflation = 0;
+			removeFromLRU(goner);
+			rebuildCacheQueue();
+			pinned.clear();
+			nextPinned = 0;
+		} else {
+			removeFromLRU(goner);
+		}
+		++_cacheStats.evictions;
+		_cacheStats.evictedBytes += goner->size();
+
 		goner->unalloc();
 #ifdef SCI_VERBOSE_RESMAN
 		debug("resMan-debug: LRU: Freeing %s (%d bytes)", goner->_id.toString().c_str(), goner->size);
 #endif
 	}
+
+	for (uint i = nextPinned; i < pinned.size(); ++i)
+		pushCacheEntry(_cacheQueue, pinned[i]);
+}
+
+void ResourceManager::setMaxCacheMemory(int bytes) {
+	_maxMemoryLRU = bytes;
+	freeOldResources();
 }
 
 Common::List<ResourceId> ResourceManager::listResources(ResourceType type, int mapNumber) {
@@ -1197,9 +1361,14 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return NULL;
 
-	if (retval->_status == kResStatusNoMalloc)
+	if (retval->_status == kResStatusNoMalloc) {
+		++_cacheStats.misses;
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
+	} else {
+		++_cacheStats.hits;
+	}
+
+	if (retval->_status == kResStatusEnqueued)
 		// The resource is removed from its current position
 		// in the LRU list because it has been requested
 		// again. Below, it will either be locked, or it
@@ -2384,6 +2553,7 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 	byte *ptr = new byte[_size];
 	_data = ptr;
 	_status = kResStatusAllocated;
+	_compression = compression;
 	errorNum = ptr ? dec->unpack(file, ptr, szPacked, _size) : SCI_ERROR_RESOURCE_TOO_BIG;
 	if (errorNum) {
 		unalloc();
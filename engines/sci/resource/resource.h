@@ -298,6 +298,9 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	ResourceCompression _compression; /**< Compression used in the resource volume */
+	uint32 _cachePriority; /**< Eviction priority while in the LRU queue, see ResourceManager::freeOldResources */
+	uint32 _cacheSerial; /**< Identifies the entry of this resource in the eviction queue */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -312,6 +315,27 @@ protected:
 
 typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
 
+/** Statistics about the resource cache, shown by the `resource_cache` debugger command */
+struct ResourceCacheStats {
+	uint32 hits;         ///< Requests for resources which were already in memory
+	uint32 misses;       ///< Requests for resources which had to be read and decompressed
+	uint32 evictions;    ///< Resources freed to stay within the memory budget
+	uint32 evictedBytes; ///< Total size of the evicted resources
+
+	ResourceCacheStats() : hits(0), misses(0), evictions(0), evictedBytes(0) {}
+};
+
+/**
+ * Entry of the resource cache eviction queue. Entries are not removed when
+ * their resource leaves the LRU queue; they are skipped when their serial no
+ * longer matches the one of the resource.
+ */
+struct ResourceCacheEntry {
+	uint32 priority;
+	uint32 serial;
+	ResourceId id;
+};
+
 class IntMapResourceSource;
 class ResourceManager {
 	// FIXME: These 'friend' declarations are meant to be a temporary hack to
@@ -475,6 +499,26 @@ public:
 	 */
 	ResourceType convertResType(byte type);
 
+	/**
+	 * Sets the amount of memory that may be used by resources which are not
+	 * locked. Unlocked resources are freed immediately if the new budget is
+	 * exceeded.
+	 */
+	void setMaxCacheMemory(int bytes);
+	int getMaxCacheMemory() const { return _maxMemoryLRU; }
+	int getCacheMemory() const { return _memoryLRU; }
+	int getLockedMemory() const { return _memoryLocked; }
+	uint getCacheEntryCount() const { return _LRU.size(); }
+	const ResourceCacheStats &getCacheStats() const { return _cacheStats; }
+	void resetCacheStats() { _cacheStats = ResourceCacheStats(); }
+
+	/**
+	 * Sets the room whose resources (its script, heap, picture, messages and
+	 * so on) are freed last when the cache is full. -1 pins no room.
+	 */
+	void setPinnedRoom(int roomNumber) { _pinnedRoom = roomNumber; }
+	int getPinnedRoom() const { return _pinnedRoom; }
+
 protected:
 	bool _detectionMode;
 
@@ -490,6 +534,11 @@ protected:
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	uint32 _cacheInflation; ///< Priority of the last evicted resource, added to the priority of newly queued ones
+	Common::Array<ResourceCacheEntry> _cacheQueue; ///< Binary min-heap of the LRU resources, ordered by priority
+	uint32 _cacheSerial; ///< Serial of the most recently queued resource
+	int _pinnedRoom; ///< See setPinnedRoom()
+	ResourceCacheStats _cacheStats;
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
@@ -636,6 +685,24 @@ protected:
 	void addToLRU(Resource *res);
 	void removeFromLRU(Resource *res);
 
+	/**
+	 * Returns the priority a resource gets when it is put in the LRU queue.
+	 * This is the relative cost of loading the resource again per byte of
+	 * memory it occupies, on top of the current cache inflation value, so
+	 * that recently used resources and resources which are expensive to
+	 * decompress are kept longer.
+	 */
+	uint32 getCachePriority(const Resource *res) const;
+
+	/**
+	 * Returns the resource referred to by an eviction queue entry, or nullptr
+	 * if the entry is stale.
+	 */
+	Resource *getQueuedResource(const ResourceCacheEntry &entry);
+
+	/** Rebuilds the eviction queue from the LRU list, dropping stale entries. */
+	void rebuildCacheQueue();
+
 	ResourceCompression getViewCompression();
 	ViewType detectViewType();
 	bool hasSci0Voc999();
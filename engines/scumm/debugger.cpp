@@ -73,6 +73,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("matrix",    WRAP_METHOD(ScummDebugger, Cmd_PrintBoxMatrix));
 	registerCmd("camera",    WRAP_METHOD(ScummDebugger, Cmd_Camera));
 	registerCmd("room",      WRAP_METHOD(ScummDebugger, Cmd_Room));
+	registerCmd("redrawbench", WRAP_METHOD(ScummDebugger, Cmd_RedrawBench));
 	registerCmd("objects",   WRAP_METHOD(ScummDebugger, Cmd_PrintObjects));
 	registerCmd("object",    WRAP_METHOD(ScummDebugger, Cmd_Object));
 	registerCmd("script",    WRAP_METHOD(ScummDebugger, Cmd_Script));
@@ -190,6 +191,41 @@ bool ScummDebugger::Cmd_Room(int argc, const char **argv) {
 	}
 }
 
+bool ScummDebugger::Cmd_RedrawBench(int argc, const char **argv) {
+	const int count = (argc > 1) ? atoi(argv[1]) : 100;
+	if (count <= 0) {
+		debugPrintf("Usage: redrawbench [<count>]\n");
+		return true;
+	}
+	if (!_vm->_roomResource) {
+		debugPrintf("No room loaded\n");
+		return true;
+	}
+
+	// Time redrawing the visible room background with the strip cache
+	// empty, then as it is redrawn (e.g. when scrolling back) afterwards
+	const int numStrips = _vm->_gdi->_numStrips;
+	_vm->_gdi->clearStripCache();
+
+	uint32 start = g_system->getMillis();
+	for (int i = 0; i < count; i++) {
+		_vm->_gdi->clearStripCache();
+		_vm->redrawBGStrip(0, numStrips);
+	}
+	const uint32 uncached = g_system->getMillis() - start;
+
+	start = g_system->getMillis();
+	for (int i = 0; i < count; i++)
+		_vm->redrawBGStrip(0, numStrips);
+	const uint32 cached = g_system->getMillis() - start;
+
+	debugPrintf("Room %d, %d strips, %d redraws: %d ms decoding, %d ms from the strip cache\n",
+		_vm->_currentRoom, numStrips, count, uncached, cached);
+
+	_vm->_fullRedraw = true;
+	return true;
+}
+
 bool ScummDebugger::Cmd_LoadGame(int argc, const char **argv) {
 	if (argc > 1) {
 		int slot = atoi(argv[1]);
@@ -45,6 +45,7 @@ private:
 	bool Cmd_LoadGame(int argc, const char **argv);
 	bool Cmd_SaveGame(int argc, const char **argv);
 	bool Cmd_Restart(int argc, const char **argv);
+	bool Cmd_RedrawBench(int argc, const char **argv);
 
 	bool Cmd_PrintActor(int argc, const char **argv);
 	bool Cmd_PrintBox(int argc, const char **argv);
@@ -215,6 +215,10 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+	memset(_stripCachePalette, 0, sizeof(_stripCachePalette));
+	_stripCacheImage = nullptr;
+	_stripCacheHits = 0;
+	_stripCacheMisses = 0;
 }
 
 Gdi::~Gdi() {
@@ -275,6 +279,27 @@ void Gdi::init() {
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	clearStripCache();
+}
+
+bool Gdi::canCacheStrips() const {
+	// Older games and the console versions have their own strip renderers,
+	// which also write the masks. The 16-bit HE renderer bakes colors from
+	// _hePalettes into the strips, which scripts may change mid-room.
+	return _vm->_game.version >= 3 &&
+		!(_vm->_game.features & GF_16BIT_COLOR) &&
+		_vm->_game.platform != Common::kPlatformNES &&
+		_vm->_game.platform != Common::kPlatformPCEngine;
+}
+
+void Gdi::clearStripCache() {
+	if (_stripCacheHits || _stripCacheMisses)
+		debugC(DEBUG_RESOURCE, "Gdi::clearStripCache(): %u strips decoded, %u redrawn from the cache", _stripCacheMisses, _stripCacheHits);
+
+	_stripCache.clear();
+	_stripCacheImage = nullptr;
+	_stripCacheHits = 0;
+	_stripCacheMisses = 0;
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -1016,7 +1041,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbRoomBackground);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1824,6 +1849,15 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	const bool useStripCache = (flag & dbRoomBackground) && canCacheStrips();
+	if (useStripCache && (ptr != _stripCacheImage || memcmp(_stripCachePalette, _vm->_roomPalette, sizeof(_stripCachePalette)))) {
+		// Strips are decoded from the room image through the room palette
+		clearStripCache();
+		_stripCacheImage = ptr;
+		memcpy(_stripCachePalette, _vm->_roomPalette, sizeof(_stripCachePalette));
+	}
+	const int stripBytes = 8 * vs->format.bytesPerPixel;
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -1856,7 +1890,35 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		else
 			dstPtr = (byte *)vs->getBasePtr(x * 8, y);
 
-		transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		CachedStrip *cachedStrip = nullptr;
+		if (useStripCache) {
+			if ((int)_stripCache.size() <= stripnr)
+				_stripCache.resize(stripnr + 1);
+			cachedStrip = &_stripCache[stripnr];
+		}
+
+		if (cachedStrip && cachedStrip->height == height) {
+			const byte *src = cachedStrip->pixels.begin();
+			byte *dst = dstPtr;
+			for (int h = 0; h < height; ++h, src += stripBytes, dst += vs->pitch)
+				memcpy(dst, src, stripBytes);
+			transpStrip = false;
+			++_stripCacheHits;
+		} else {
+			transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+
+			// Strips with transparent pixels depend on what was drawn
+			// underneath them before, so they can't be reused
+			if (cachedStrip && !transpStrip) {
+				++_stripCacheMisses;
+				cachedStrip->height = height;
+				cachedStrip->pixels.resize(height * stripBytes);
+				byte *dst = cachedStrip->pixels.begin();
+				const byte *src = dstPtr;
+				for (int h = 0; h < height; ++h, src += vs->pitch, dst += stripBytes)
+					memcpy(dst, src, stripBytes);
+			}
+		}
 
 		// COMI and HE games only uses flag value
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
@@ -24,6 +24,7 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/array.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -209,7 +210,43 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/**
+	 * A decoded strip of the room background, see _stripCache.
+	 */
+	struct CachedStrip {
+		int height;
+		Common::Array<byte> pixels;
+
+		CachedStrip() : height(0) {}
+	};
+
+	/**
+	 * Decoded strips of the current room background, indexed by strip number,
+	 * so that redrawing parts of the room (e.g. when scrolling back) does not
+	 * decompress the same strips again. Only opaque strips are cached.
+	 */
+	Common::Array<CachedStrip> _stripCache;
+
+	/** The room palette the strips in _stripCache were decoded with. */
+	byte _stripCachePalette[256];
+
+	/** The room image the strips in _stripCache were decoded from. */
+	const byte *_stripCacheImage;
+
+	/** Strips drawn from and decoded into _stripCache since it was last cleared. */
+	uint32 _stripCacheHits;
+	uint32 _stripCacheMisses;
+
+	/**
+	 * Returns whether room background strips drawn by this renderer may be
+	 * stored in the strip cache.
+	 */
+	bool canCacheStrips() const;
+
 public:
+	/** Forgets all cached room background strips. */
+	void clearStripCache();
+
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
 
@@ -282,7 +319,8 @@ public:
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbRoomBackground = 1 << 4 ///< The room background is drawn and may use the strip cache
 	};
 };
 
@@ -60,6 +60,12 @@ const ShapeInfo *MainShapeArchive::getShapeInfo(uint32 shapenum) {
 	return _typeFlags->getShapeInfo(shapenum);
 }
 
+int32 MainShapeArchive::getMaxFootpadWorld() const {
+	assert(_typeFlags);
+
+	return _typeFlags->getMaxFootpadWorld();
+}
+
 void MainShapeArchive::loadAnimDat(Common::SeekableReadStream *rs) {
 	if (_animDat) {
 		delete _animDat;
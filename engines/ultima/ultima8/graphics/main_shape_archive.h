@@ -52,6 +52,7 @@ public:
 	void loadTypeFlags(Common::SeekableReadStream *rs);
 	void loadDamageDat(Common::SeekableReadStream *rs);
 	const ShapeInfo *getShapeInfo(uint32 shapenum);
+	int32 getMaxFootpadWorld() const;
 
 	void loadAnimDat(Common::SeekableReadStream *rs);
 	const ActorAnim *getAnim(uint32 shape) const;
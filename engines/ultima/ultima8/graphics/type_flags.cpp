@@ -35,7 +35,7 @@
 namespace Ultima {
 namespace Ultima8 {
 
-TypeFlags::TypeFlags() {
+TypeFlags::TypeFlags() : _maxFootpadWorld(0) {
 }
 
 
@@ -61,6 +61,7 @@ void TypeFlags::load(Common::SeekableReadStream *rs) {
 
 	_shapeInfo.clear();
 	_shapeInfo.resize(count);
+	_maxFootpadWorld = 0;
 
 	for (uint32 i = 0; i < count; ++i) {
 		uint8 data[9];
@@ -156,6 +157,10 @@ void TypeFlags::load(Common::SeekableReadStream *rs) {
 		si._weaponInfo = nullptr;
 		si._armourInfo = nullptr;
 
+		int32 xd, yd, zd;
+		si.getFootpadWorld(xd, yd, zd, 0);
+		_maxFootpadWorld = MAX(_maxFootpadWorld, MAX(xd, yd));
+
 		_shapeInfo[i] = si;
 	}
 
@@ -38,12 +38,18 @@ public:
 	void loadDamageDat(Common::SeekableReadStream *rs);
 	ShapeInfo *getShapeInfo(uint32 shape);
 
+	//! Largest x or y footpad, in world units, of any shape
+	int32 getMaxFootpadWorld() const {
+		return _maxFootpadWorld;
+	}
+
 private:
 	void loadWeaponInfo();
 	void loadArmourInfo();
 	void loadMonsterInfo();
 
 	Std::vector<ShapeInfo> _shapeInfo;
+	int32 _maxFootpadWorld;
 };
 
 } // End of namespace Ultima8
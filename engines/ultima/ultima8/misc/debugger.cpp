@@ -49,6 +49,7 @@
 #include "ultima/ultima8/world/camera_process.h"
 #include "ultima/ultima8/world/get_object.h"
 #include "ultima/ultima8/world/item_factory.h"
+#include "ultima/ultima8/world/item_sorter.h"
 #include "ultima/ultima8/world/actors/quick_avatar_mover_process.h"
 #include "ultima/ultima8/world/actors/avatar_mover_process.h"
 #include "ultima/ultima8/world/target_reticle_process.h"
@@ -132,6 +133,7 @@ Debugger::Debugger() : Shared::Debugger() {
 	registerCmd("GameMapGump::dumpMap", WRAP_METHOD(Debugger, cmdDumpMap));
 	registerCmd("GameMapGump::incrementSortOrder", WRAP_METHOD(Debugger, cmdIncrementSortOrder));
 	registerCmd("GameMapGump::decrementSortOrder", WRAP_METHOD(Debugger, cmdDecrementSortOrder));
+	registerCmd("GameMapGump::sortStats", WRAP_METHOD(Debugger, cmdSortStats));
 
 	registerCmd("Kernel::processTypes", WRAP_METHOD(Debugger, cmdProcessTypes));
 	registerCmd("Kernel::processInfo", WRAP_METHOD(Debugger, cmdProcessInfo));
@@ -187,6 +189,7 @@ Debugger::Debugger() : Shared::Debugger() {
 	registerCmd("UCMachine::stopTrace", WRAP_METHOD(Debugger, cmdStopTrace));
 #endif
 
+	registerCmd("CurrentMap::queryStats", WRAP_METHOD(Debugger, cmdQueryStats));
 	registerCmd("FastAreaVisGump::toggle", WRAP_METHOD(Debugger, cmdToggleFastArea));
 	registerCmd("InverterProcess::invertScreen", WRAP_METHOD(Debugger, cmdInvertScreen));
 	registerCmd("MenuGump::showMenu", WRAP_METHOD(Debugger, cmdShowMenu));
@@ -912,6 +915,19 @@ bool Debugger::cmdDecrementSortOrder(int argc, const char **argv) {
 	return false;
 }
 
+bool Debugger::cmdSortStats(int argc, const char **argv) {
+	GameMapGump *gump = Ultima8Engine::get_instance()->getGameMapGump();
+	if (!gump) {
+		debugPrintf("No game map\n");
+		return true;
+	}
+
+	const ItemSorter::SortStats &stats = gump->getDisplayList()->getStats();
+	debugPrintf("Last frame: %u items, %u compared, %u overlapping\n",
+	            stats._items, stats._compared, stats._overlapped);
+	return true;
+}
+
 
 bool Debugger::cmdProcessTypes(int argc, const char **argv) {
 	Kernel::get_instance()->processTypes();
@@ -1895,6 +1911,22 @@ bool Debugger::cmdGenerateWholeMap(int argc, const char **argv) {
 	return false;
 }
 
+bool Debugger::cmdQueryStats(int argc, const char **argv) {
+	CurrentMap *currentmap = World::get_instance()->getCurrentMap();
+	const CurrentMap::QueryStats &stats = currentmap->getQueryStats();
+
+	debugPrintf("Item queries: %u, chunks scanned: %u, items tested: %u\n",
+	            stats._queries, stats._chunks, stats._items);
+	if (stats._queries)
+		debugPrintf("Per query: %.2f chunks, %.2f items\n",
+		            (double)stats._chunks / stats._queries,
+		            (double)stats._items / stats._queries);
+
+	if (argc > 1 && !strcmp(argv[1], "reset"))
+		currentmap->resetQueryStats();
+	return true;
+}
+
 #ifdef DEBUG
 bool Debugger::cmdVisualDebugPathfinder(int argc, const char **argv) {
 	if (argc != 2) {
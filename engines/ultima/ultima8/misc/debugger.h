@@ -198,6 +198,7 @@ private:
 	bool cmdDumpMap(int argc, const char **argvv);
 	bool cmdIncrementSortOrder(int argc, const char **argv);
 	bool cmdDecrementSortOrder(int argc, const char **argv);
+	bool cmdSortStats(int argc, const char **argv);
 
 	// Kernel
 	bool cmdProcessTypes(int argc, const char **argv);
@@ -264,6 +265,7 @@ private:
 	bool cmdU8ShapeViewer(int argc, const char **argv);
 	bool cmdShowMenu(int argc, const char **argv);
 	bool cmdGenerateWholeMap(int argc, const char **argv);
+	bool cmdQueryStats(int argc, const char **argv);
 	bool cmdToggleMinimap(int argc, const char **argv);
 	bool cmdInvertScreen(int argc, const char **argv);
 	bool cmdPlayMovie(int argc, const char **argv);
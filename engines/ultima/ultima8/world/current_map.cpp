@@ -69,6 +69,8 @@ CurrentMap::CurrentMap() : _currentMap(0), _eggHatcher(0),
 	for (unsigned int i = 0; i < MAP_NUM_TARGET_ITEMS; i++) {
 		_targets[i] = 0;
 	}
+
+	resetQueryStats();
 }
 
 
@@ -510,6 +512,31 @@ void CurrentMap::clipMapChunks(int &minx, int &maxx, int &miny, int &maxy) const
 	maxy = CLIP(maxy, 0, MAP_NUM_CHUNKS - 1);
 }
 
+void CurrentMap::getQueryChunks(int32 x0, int32 y0, int32 x1, int32 y1,
+                                int &minx, int &maxx, int &miny, int &maxy) const {
+	// Items are stored in the chunk holding their origin, which is the
+	// max x/y corner of their footpad. An item spans (ix - ixd, ix), and
+	// no footpad is larger than the largest one in the typeflags, so only
+	// origins in [x0, x1 + maxfootpad] can reach the rectangle. One unit
+	// of slack on each side keeps items that merely touch it.
+	const int32 maxfootpad = GameData::get_instance()->getMainShapes()->getMaxFootpadWorld();
+
+	minx = (x0 - 1) / _mapChunkSize;
+	maxx = (x1 + maxfootpad + 1) / _mapChunkSize;
+	miny = (y0 - 1) / _mapChunkSize;
+	maxy = (y1 + maxfootpad + 1) / _mapChunkSize;
+	clipMapChunks(minx, maxx, miny, maxy);
+
+	_queryStats._queries++;
+	_queryStats._chunks += (maxx - minx + 1) * (maxy - miny + 1);
+}
+
+void CurrentMap::resetQueryStats() {
+	_queryStats._queries = 0;
+	_queryStats._chunks = 0;
+	_queryStats._items = 0;
+}
+
 void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
                             uint32 scriptsize, const Item *check, uint16 range,
                             bool recurse, int32 x, int32 y) const {
@@ -525,11 +552,9 @@ void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 
 	const Rect searchrange(x - xd - range, y - yd - range, x + range, y + range);
 
-	int minx = ((x - xd - range) / _mapChunkSize) - 1;
-	int maxx = ((x + range) / _mapChunkSize) + 1;
-	int miny = ((y - yd - range) / _mapChunkSize) - 1;
-	int maxy = ((y + range) / _mapChunkSize) + 1;
-	clipMapChunks(minx, maxx, miny, maxy);
+	int minx, maxx, miny, maxy;
+	getQueryChunks(x - xd - range, y - yd - range, x + range, y + range,
+	               minx, maxx, miny, maxy);
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
@@ -538,6 +563,7 @@ void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 			        iter != _items[cx][cy].end(); ++iter) {
 
 				const Item *item = *iter;
+				_queryStats._items++;
 
 				if (item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
@@ -594,11 +620,9 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 	const Rect searchrange(origin[0] - dims[0], origin[1] - dims[1],
 	                       origin[0], origin[1]);
 
-	int minx = ((origin[0] - dims[0]) / _mapChunkSize) - 1;
-	int maxx = ((origin[0]) / _mapChunkSize) + 1;
-	int miny = ((origin[1] - dims[1]) / _mapChunkSize) - 1;
-	int maxy = ((origin[1]) / _mapChunkSize) + 1;
-	clipMapChunks(minx, maxx, miny, maxy);
+	int minx, maxx, miny, maxy;
+	getQueryChunks(origin[0] - dims[0], origin[1] - dims[1],
+	               origin[0], origin[1], minx, maxx, miny, maxy);
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
@@ -607,6 +631,7 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 			        iter != _items[cx][cy].end(); ++iter) {
 
 				const Item *item = *iter;
+				_queryStats._items++;
 
 				if (item->getObjId() == check)
 					continue;
@@ -725,11 +750,8 @@ bool CurrentMap::isValidPosition(int32 x, int32 y, int32 z,
 	ObjId roof = 0;
 	int32 roofz = INT_MAX_VALUE;
 
-	int minx = ((x - xd) / _mapChunkSize) - 1;
-	int maxx = (x / _mapChunkSize) + 1;
-	int miny = ((y - yd) / _mapChunkSize) - 1;
-	int maxy = (y / _mapChunkSize) + 1;
-	clipMapChunks(minx, maxx, miny, maxy);
+	int minx, maxx, miny, maxy;
+	getQueryChunks(x - xd, y - yd, x, y, minx, maxx, miny, maxy);
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
@@ -737,6 +759,7 @@ bool CurrentMap::isValidPosition(int32 x, int32 y, int32 z,
 			for (iter = _items[cx][cy].begin();
 				 iter != _items[cx][cy].end(); ++iter) {
 				const Item *item = *iter;
+				_queryStats._items++;
 				if (item->getObjId() == item_)
 					continue;
 				if (item->hasExtFlags(Item::EXT_SPRITE))
@@ -841,11 +864,10 @@ bool CurrentMap::scanForValidPosition(int32 x, int32 y, int32 z, const Item *ite
 	// next, we'll loop over all objects in the area, and mark the areas
 	// overlapped and supported by each object
 
-	int minx = ((x - xd) / _mapChunkSize) - 1;
-	int maxx = (x / _mapChunkSize) + 1;
-	int miny = ((y - yd) / _mapChunkSize) - 1;
-	int maxy = (y / _mapChunkSize) + 1;
-	clipMapChunks(minx, maxx, miny, maxy);
+	// Positions up to 8 units away are scanned, so widen the area by that
+	int minx, maxx, miny, maxy;
+	getQueryChunks(x - xd - 8, y - yd - 8, x + 8, y + 8,
+	               minx, maxx, miny, maxy);
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
@@ -853,6 +875,7 @@ bool CurrentMap::scanForValidPosition(int32 x, int32 y, int32 z, const Item *ite
 			for (iter = _items[cx][cy].begin();
 			        iter != _items[cx][cy].end(); ++iter) {
 				const Item *citem = *iter;
+				_queryStats._items++;
 				if (citem->getObjId() == item->getObjId())
 					continue;
 				if (citem->hasExtFlags(Item::EXT_SPRITE))
@@ -979,27 +1002,12 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
                            Std::list<SweepItem> *hit) const {
 	const uint32 blockflagmask = (ShapeInfo::SI_SOLID | ShapeInfo::SI_DAMAGING);
 
-	int minx = ((start[0] - dims[0]) / _mapChunkSize) - 1;
-	int maxx = (start[0] / _mapChunkSize) + 1;
-	int miny = ((start[1] - dims[1]) / _mapChunkSize) - 1;
-	int maxy = (start[1] / _mapChunkSize) + 1;
-
-	{
-		int dminx = ((end[0] - dims[0]) / _mapChunkSize) - 1;
-		int dmaxx = (end[0] / _mapChunkSize) + 1;
-		int dminy = ((end[1] - dims[1]) / _mapChunkSize) - 1;
-		int dmaxy = (end[1] / _mapChunkSize) + 1;
-		if (dminx < minx)
-			minx = dminx;
-		if (dmaxx > maxx)
-			maxx = dmaxx;
-		if (dminy < miny)
-			miny = dminy;
-		if (dmaxy > maxy)
-			maxy = dmaxy;
-	}
-
-	clipMapChunks(minx, maxx, miny, maxy);
+	// Only items touching the swept volume can be hit
+	int minx, maxx, miny, maxy;
+	getQueryChunks(MIN(start[0], end[0]) - dims[0],
+	               MIN(start[1], end[1]) - dims[1],
+	               MAX(start[0], end[0]), MAX(start[1], end[1]),
+	               minx, maxx, miny, maxy);
 
 	// Get velocity, extents, and centre of item
 	int32 vel[3];
@@ -1027,6 +1035,7 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 			for (iter = _items[cx][cy].begin();
 			        iter != _items[cx][cy].end(); ++iter) {
 				const Item *other_item = *iter;
+				_queryStats._items++;
 				if (other_item->getObjId() == item)
 					continue;
 				if (other_item->hasExtFlags(Item::EXT_SPRITE))
@@ -210,6 +210,18 @@ public:
 	// Set the entire map as being 'fast'
 	void setWholeMapFast();
 
+	//! Counters for the item queries (isValidPosition, sweepTest, ...)
+	struct QueryStats {
+		uint32 _queries;
+		uint32 _chunks;
+		uint32 _items;
+	};
+
+	const QueryStats &getQueryStats() const {
+		return _queryStats;
+	}
+	void resetQueryStats();
+
 	void save(Common::WriteStream *ws);
 	bool load(Common::ReadStream *rs, uint32 version);
 
@@ -223,6 +235,11 @@ private:
 	//! clip the given map chunk numbers to iterate over them safely
 	void clipMapChunks(int &minx, int &maxx, int &miny, int &maxy) const;
 
+	//! Get the (clipped) range of map chunks which can hold items whose
+	//! footpad overlaps or touches the world rectangle (x0,y0)-(x1,y1)
+	void getQueryChunks(int32 x0, int32 y0, int32 x1, int32 y1,
+	                    int &minx, int &maxx, int &miny, int &maxy) const;
+
 	Map *_currentMap;
 
 	// item lists. Lots of them :-)
@@ -237,6 +254,8 @@ private:
 
 	int _mapChunkSize;
 
+	mutable QueryStats _queryStats;
+
 	//! Items that are "targetable" in Crusader. It might be faster to store
 	//! this in a more fancy data structure, but this works fine.
 	ObjId _targets[200];
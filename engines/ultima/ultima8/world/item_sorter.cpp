@@ -585,6 +585,8 @@ ItemSorter::ItemSorter() :
 	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0) {
 	int i = 2048;
 	while (i--) _itemsUnused = new SortItem(_itemsUnused);
+	_entries.reserve(2048);
+	_stats._items = _stats._compared = _stats._overlapped = 0;
 }
 
 ItemSorter::~ItemSorter() {
@@ -617,10 +619,13 @@ void ItemSorter::BeginDisplayList(RenderSurface *rs,
 	}
 	_items = nullptr;
 	_itemsTail = nullptr;
+	// Keeps the allocated storage for the next frame
+	_entries.resize(0);
 
 	// Set the RenderSurface, and reset the item list
 	_surf = rs;
 	_orderCounter = 0;
+	_stats._items = _stats._compared = _stats._overlapped = 0;
 
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	_camSx = (camx - camy) / 4;
@@ -712,19 +717,34 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
+	// Iterate the list and compare _shapes. This walks the compact entries
+	// rather than the SortItems, so items that share no screen columns with
+	// us are skipped without touching them.
 
 	// Ok,
 	SortItem *addpoint = nullptr;
-	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
+	uint addindex = _entries.size();
+	uint i;
+	for (i = 0; i < _entries.size(); ++i) {
+		const SortEntry &entry = _entries[i];
+
 		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->ListLessThan(si2))
-			addpoint = si2;
+		// (same test as ListLessThan)
+		if (!addpoint && (si->_z < entry._z || (si->_z == entry._z && si->_flat))) {
+			addpoint = entry._item;
+			addindex = i;
+		}
 
 		// Doesn't overlap
+		if (si->_sxRight <= entry._sxLeft || si->_sxLeft >= entry._sxRight)
+			continue;
+
+		SortItem *si2 = entry._item;
 		if (si2->_occluded || !si->overlap(*si2))
 			continue;
 
+		_stats._overlapped++;
+
 		// Attempt to find which is infront
 		if (*si < *si2) {
 			// si2 occludes si (us)
@@ -746,6 +766,16 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 		}
 	}
 
+	_stats._items++;
+	_stats._compared += i;
+
+	SortEntry entry;
+	entry._z = si->_z;
+	entry._sxLeft = si->_sxLeft;
+	entry._sxRight = si->_sxRight;
+	entry._item = si;
+	_entries.insert_at(addindex, entry);
+
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
 
@@ -23,6 +23,8 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "ultima/shared/std/containers.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
@@ -32,6 +34,24 @@ class RenderSurface;
 struct SortItem;
 
 class ItemSorter {
+public:
+	//! Counters for the last display list
+	struct SortStats {
+		uint32 _items;      // Items added to the display list
+		uint32 _compared;   // Items walked while adding them
+		uint32 _overlapped; // Items that overlapped on screen
+	};
+
+private:
+	//! Compact copy of the fields AddItem needs to walk the display list,
+	//! kept in the same order as the _items list
+	struct SortEntry {
+		int32       _z;
+		int32       _sxLeft;
+		int32       _sxRight;
+		SortItem    *_item;
+	};
+
 	MainShapeArchive    *_shapes;
 	RenderSurface   *_surf;
 
@@ -40,6 +60,9 @@ class ItemSorter {
 	SortItem    *_itemsUnused;
 	int32       _sortLimit;
 
+	Std::vector<SortEntry> _entries;
+	SortStats   _stats;
+
 	int32       _orderCounter;
 
 	int32       _camSx, _camSy;
@@ -72,6 +95,10 @@ public:
 		if (_sortLimit > 0) _sortLimit--;
 	}
 
+	const SortStats &getStats() const {
+		return _stats;
+	}
+
 private:
 	bool PaintSortItem(SortItem *);
 	bool NullPaintSortItem(SortItem *);
@@ -37,11 +37,16 @@
 
 namespace Wintermute {
 
+// Default budget for the decoded pixel data of all stored surfaces
+static const uint32 kDefaultSurfaceMemoryBudget = 128 * 1024 * 1024;
+
 //IMPLEMENT_PERSISTENT(BaseSurfaceStorage, true);
 
 //////////////////////////////////////////////////////////////////////
 BaseSurfaceStorage::BaseSurfaceStorage(BaseGame *inGame) : BaseClass(inGame) {
 	_lastCleanupTime = 0;
+	_maxMemory = kDefaultSurfaceMemoryBudget;
+	_numEvictions = 0;
 }
 
 
@@ -60,6 +65,7 @@ bool BaseSurfaceStorage::cleanup(bool warn) {
 		delete _surfaces[i];
 	}
 	_surfaces.clear();
+	_surfaceMap.clear();
 
 	return STATUS_OK;
 }
@@ -67,9 +73,15 @@ bool BaseSurfaceStorage::cleanup(bool warn) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::initLoop() {
-	if (_gameRef->_smartCache && _gameRef->getLiveTimer()->getTime() - _lastCleanupTime >= _gameRef->_surfaceGCCycleTime) {
-		_lastCleanupTime = _gameRef->getLiveTimer()->getTime();
-		sortSurfaces();
+	if (_gameRef->getLiveTimer()->getTime() - _lastCleanupTime < _gameRef->_surfaceGCCycleTime) {
+		return STATUS_OK;
+	}
+
+	uint32 prevCleanupTime = _lastCleanupTime;
+	_lastCleanupTime = _gameRef->getLiveTimer()->getTime();
+	sortSurfaces();
+
+	if (_gameRef->_smartCache) {
 		for (uint32 i = 0; i < _surfaces.size(); i++) {
 			if (_surfaces[i]->_lifeTime <= 0) {
 				break;
@@ -81,6 +93,50 @@ bool BaseSurfaceStorage::initLoop() {
 			}
 		}
 	}
+
+	// The surfaces are sorted with the least recently used evictable ones first.
+	// This runs at the start of a frame, so keep whatever was drawn since the
+	// previous cleanup.
+	return enforceMemoryBudget(prevCleanupTime);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+uint32 BaseSurfaceStorage::getMemoryUsage() const {
+	uint32 total = 0;
+	for (uint32 i = 0; i < _surfaces.size(); i++) {
+		if (_surfaces[i]->_valid) {
+			total += _surfaces[i]->getWidth() * _surfaces[i]->getHeight() * 4;
+		}
+	}
+	return total;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::enforceMemoryBudget(uint32 keepUsedSince) {
+	uint32 total = getMemoryUsage();
+	if (total <= _maxMemory) {
+		return STATUS_OK;
+	}
+
+	for (uint32 i = 0; i < _surfaces.size() && total > _maxMemory; i++) {
+		BaseSurface *surface = _surfaces[i];
+		if (surface->_lifeTime <= 0) {
+			break;
+		}
+
+		if (!surface->_valid || surface->_lastUsedTime >= keepUsedSince) {
+			continue;
+		}
+
+		uint32 size = surface->getWidth() * surface->getHeight() * 4;
+		if (surface->invalidate()) {
+			total -= MIN(size, total);
+			_numEvictions++;
+		}
+	}
+
 	return STATUS_OK;
 }
 
@@ -91,6 +147,10 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 		if (_surfaces[i] == surface) {
 			_surfaces[i]->_referenceCount--;
 			if (_surfaces[i]->_referenceCount <= 0) {
+				SurfaceMap::iterator it = _surfaceMap.find(_surfaces[i]->getFileName());
+				if (it != _surfaceMap.end() && it->_value == _surfaces[i]) {
+					_surfaceMap.erase(it);
+				}
 				delete _surfaces[i];
 				_surfaces.remove_at(i);
 			}
@@ -103,11 +163,10 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 
 //////////////////////////////////////////////////////////////////////
 BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime, bool keepLoaded) {
-	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (scumm_stricmp(_surfaces[i]->getFileName(), filename.c_str()) == 0) {
-			_surfaces[i]->_referenceCount++;
-			return _surfaces[i];
-		}
+	SurfaceMap::iterator it = _surfaceMap.find(filename);
+	if (it != _surfaceMap.end()) {
+		it->_value->_referenceCount++;
+		return it->_value;
 	}
 
 	if (!BaseFileManager::getEngineInstance()->hasFile(filename)) {
@@ -134,6 +193,7 @@ BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool
 	} else {
 		surface->_referenceCount = 1;
 		_surfaces.push_back(surface);
+		_surfaceMap[filename] = surface;
 		return surface;
 	}
 }
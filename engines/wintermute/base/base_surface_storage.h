@@ -31,6 +31,8 @@
 
 #include "engines/wintermute/base/base.h"
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 
 namespace Wintermute {
 class BaseSurface;
@@ -49,7 +51,26 @@ public:
 	BaseSurfaceStorage(BaseGame *inGame);
 	~BaseSurfaceStorage() override;
 
+	/**
+	 * Invalidates least recently used surfaces until the decoded pixel data
+	 * of all stored surfaces fits into the memory budget. Only surfaces with
+	 * a limited lifetime are considered, as those can be reloaded from their
+	 * image file on their next use. Surfaces used at or after keepUsedSince
+	 * are kept.
+	 */
+	bool enforceMemoryBudget(uint32 keepUsedSince);
+	uint32 getMemoryUsage() const;
+	uint32 getMaxMemory() const { return _maxMemory; }
+	void setMaxMemory(uint32 maxMemory) { _maxMemory = maxMemory; }
+	uint32 getNumEvictions() const { return _numEvictions; }
+
 	Common::Array<BaseSurface *> _surfaces;
+
+private:
+	typedef Common::HashMap<Common::String, BaseSurface *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SurfaceMap;
+	SurfaceMap _surfaceMap;
+	uint32 _maxMemory;
+	uint32 _numEvictions;
 };
 
 } // End of namespace Wintermute
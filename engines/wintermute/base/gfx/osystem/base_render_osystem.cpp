@@ -34,6 +34,7 @@
 #include "engines/wintermute/math/math_util.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/wintermute.h"
 #include "common/system.h"
 #include "graphics/transparent_surface.h"
 #include "common/queue.h"
@@ -41,6 +42,13 @@
 
 #define DIRTY_RECT_LIMIT 800
 
+// Maximum number of separate dirty regions, before all of them are merged into one
+#define DIRTY_RECT_MAX_REGIONS 16
+
+// Number of pixels that a separate redraw is considered to cost on top of its area,
+// used to decide whether two dirty regions should be merged.
+#define DIRTY_RECT_OVERHEAD 2048
+
 namespace Wintermute {
 
 BaseRenderer *makeOSystemRenderer(BaseGame *inGame) {
@@ -57,8 +65,8 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
+	_statsDirtyRects = _statsTicketsDrawn = _statsPixelsDrawn = 0;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
 	}
@@ -75,8 +83,6 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
-
 	_renderSurface->free();
 	delete _renderSurface;
 	_blankSurface->free();
@@ -162,8 +168,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -202,9 +207,7 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -314,6 +317,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		RenderTicket *compareTicket = nullptr;
 		for (; it != endIterator; ++it) {
 			compareTicket = *it;
+			// operator== checks the precomputed hashes first
 			if (*(compareTicket) == compare && compareTicket->_isValid) {
 				if (_disableDirtyRects) {
 					drawFromSurface(compareTicket);
@@ -386,12 +390,40 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirty(rect);
+	dirty.clip(_renderRect);
+	if (dirty.isEmpty()) {
+		return;
+	}
+
+	// Merge with every region that overlaps the new one, or where redrawing the
+	// bounding box is cheaper than redrawing both separately. Merging can make
+	// the region touch others, so keep going until nothing changes.
+	bool merged = true;
+	while (merged) {
+		merged = false;
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			const Common::Rect &other = _dirtyRects[i];
+			Common::Rect bounds(dirty);
+			bounds.extend(other);
+			if (dirty.intersects(other) ||
+				bounds.width() * bounds.height() <= dirty.width() * dirty.height() + other.width() * other.height() + DIRTY_RECT_OVERHEAD) {
+				dirty = bounds;
+				_dirtyRects.remove_at(i);
+				merged = true;
+				break;
+			}
+		}
+	}
+
+	_dirtyRects.push_back(dirty);
+
+	if (_dirtyRects.size() > DIRTY_RECT_MAX_REGIONS) {
+		for (uint i = 1; i < _dirtyRects.size(); i++) {
+			_dirtyRects[0].extend(_dirtyRects[i]);
+		}
+		_dirtyRects.resize(1);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -410,7 +442,12 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+
+	_statsDirtyRects = _dirtyRects.size();
+	_statsTicketsDrawn = 0;
+	_statsPixelsDrawn = 0;
+
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -420,29 +457,57 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
+	// The regions never overlap, so each one can be redrawn on its own.
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		drawDirtyRect(_dirtyRects[i]);
+	}
+
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+		(*it)->_wantsDraw = false;
+	}
 	_lastFrameIter = _renderQueue.end();
+
+	debugC(2, kWintermuteDebugRender, "BaseRenderOSystem: %u dirty rects, %u tickets, %u pixels redrawn", _statsDirtyRects, _statsTicketsDrawn, _statsPixelsDrawn);
+
+	it = _renderQueue.begin();
+	// Clean out the old tickets
+	while (it != _renderQueue.end()) {
+		if ((*it)->_isValid == false) {
+			RenderTicket *ticket = *it;
+			addDirtyRect((*it)->_dstRect);
+			it = _renderQueue.erase(it);
+			delete ticket;
+		} else {
+			++it;
+		}
+	}
+
+}
+
+void BaseRenderOSystem::drawDirtyRect(const Common::Rect &dirtyRect) {
+	RenderQueueIterator it = _renderQueue.begin();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+	if (it != _renderQueue.end() && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+		// If our single opaque rect covers the dirty rect, we can skip filling.
+		if (!(*it)->_dstRect.contains(dirtyRect)) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
 		// Otherwise Do NOT fill.
 	} else {
 		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+		_renderSurface->fillRect(dirtyRect, _clearColor);
 	}
 	for (; it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
+		if (ticket->_dstRect.intersects(dirtyRect)) {
 			// dstClip is the area we want redrawn.
 			Common::Rect dstClip(ticket->_dstRect);
 			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
+			dstClip.clip(dirtyRect);
 			// we need to keep track of the position to redraw the dirty rect
 			Common::Rect pos(dstClip);
 			int16 offsetX = ticket->_dstRect.left;
@@ -452,25 +517,12 @@ void BaseRenderOSystem::drawTickets() {
 
 			drawFromSurface(ticket, &pos, &dstClip);
 			_needsFlip = true;
-		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
-	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
-	it = _renderQueue.begin();
-	// Clean out the old tickets
-	while (it != _renderQueue.end()) {
-		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
-		} else {
-			++it;
+			_statsTicketsDrawn++;
+			_statsPixelsDrawn += pos.width() * pos.height();
 		}
 	}
-
+	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
 }
 
 // Replacement for SDL2's SDL_RenderCopy
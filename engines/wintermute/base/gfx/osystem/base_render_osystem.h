@@ -33,6 +33,7 @@
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "common/list.h"
+#include "common/array.h"
 #include "graphics/transform_struct.h"
 
 namespace Wintermute {
@@ -118,6 +119,8 @@ public:
 private:
 	/**
 	 * Mark a specified rect of the screen as dirty.
+	 * The rect is merged with the already dirty regions that it overlaps,
+	 * or that are close enough for a single redraw to be cheaper.
 	 * @param rect the region to be marked as dirty
 	 */
 	void addDirtyRect(const Common::Rect &rect);
@@ -125,13 +128,23 @@ private:
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Redraw a single dirty region from the tickets that intersect it.
+	 * @param dirtyRect the region to be redrawn
+	 */
+	void drawDirtyRect(const Common::Rect &dirtyRect);
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
 
+	// Statistics of the last frame drawn through drawTickets()
+	uint32 _statsDirtyRects;
+	uint32 _statsTicketsDrawn;
+	uint32 _statsPixelsDrawn;
+
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
 	Common::Rect _renderRect;
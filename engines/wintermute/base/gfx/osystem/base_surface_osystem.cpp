@@ -64,7 +64,9 @@ BaseSurfaceOSystem::~BaseSurfaceOSystem() {
 	delete[] _alphaMask;
 	_alphaMask = nullptr;
 
-	_gameRef->addMem(-_width * _height * 4);
+	if (_valid) {
+		_gameRef->addMem(-_width * _height * 4);
+	}
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
 }
@@ -211,6 +213,28 @@ bool BaseSurfaceOSystem::finishLoad() {
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceOSystem::invalidate() {
+	// Only surfaces backed by an image file can be decoded again later on
+	if (!_loaded || !_valid || _filename.empty()) {
+		return STATUS_FAILED;
+	}
+
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+	renderer->invalidateTicketsFromSurface(this);
+
+	_surface->free();
+	delete[] _alphaMask;
+	_alphaMask = nullptr;
+
+	_gameRef->addMem(-_width * _height * 4);
+
+	// finishLoad() decodes the image again on the next draw
+	_loaded = false;
+	_valid = false;
+	return STATUS_OK;
+}
+
 //////////////////////////////////////////////////////////////////////////
 void BaseSurfaceOSystem::genAlphaMask(Graphics::Surface *surface) {
 	warning("BaseSurfaceOSystem::GenAlphaMask - Not ported yet");
@@ -312,6 +336,13 @@ bool BaseSurfaceOSystem::isTransparentAt(int x, int y) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceOSystem::isTransparentAtLite(int x, int y) {
+	// Hit tests need the pixels of surfaces evicted by the surface storage
+	// as well, so decode them again like drawSprite() does
+	if (!_loaded) {
+		_lastUsedTime = _gameRef->getLiveTimer()->getTime();
+		finishLoad();
+	}
+
 	if (x < 0 || x >= _surface->w || y < 0 || y >= _surface->h) {
 		return true;
 	}
@@ -408,6 +439,7 @@ bool BaseSurfaceOSystem::displayTiled(int x, int y, Rect32 rect, int numTimesX,
 bool BaseSurfaceOSystem::drawSprite(int x, int y, Rect32 *rect, Rect32 *newRect, Graphics::TransformStruct transform) {
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 
+	_lastUsedTime = _gameRef->getLiveTimer()->getTime();
 	if (!_loaded) {
 		finishLoad();
 	}
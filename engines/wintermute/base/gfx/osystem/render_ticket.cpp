@@ -42,6 +42,7 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	_isValid(true),
 	_wantsDraw(true),
 	_transform(transform) {
+	_hash = computeHash();
 	if (surf) {
 		_surface = new Graphics::Surface();
 		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
@@ -89,8 +90,24 @@ RenderTicket::~RenderTicket() {
 	}
 }
 
+uint32 RenderTicket::computeHash() const {
+	uint32 hash = (uint32)(size_t)_owner;
+	hash = hash * 31 + (uint16)_dstRect.left + ((uint16)_dstRect.top << 16);
+	hash = hash * 31 + (uint16)_dstRect.right + ((uint16)_dstRect.bottom << 16);
+	hash = hash * 31 + (uint16)_srcRect.left + ((uint16)_srcRect.top << 16);
+	hash = hash * 31 + (uint16)_srcRect.right + ((uint16)_srcRect.bottom << 16);
+	hash = hash * 31 + (uint32)_transform._angle;
+	hash = hash * 31 + _transform._rgbaMod;
+	hash = hash * 31 + (uint16)_transform._zoom.x + ((uint16)_transform._zoom.y << 16);
+	hash = hash * 31 + (uint16)_transform._offset.x + ((uint16)_transform._offset.y << 16);
+	hash = hash * 31 + _transform._flip + (_transform._alphaDisable << 8) + ((uint32)_transform._blendMode << 16);
+	hash = hash * 31 + (uint32)_transform._numTimesX + ((uint32)_transform._numTimesY << 16);
+	return hash;
+}
+
 bool RenderTicket::operator==(const RenderTicket &t) const {
-	if ((t._owner != _owner) ||
+	if ((t._hash != _hash) ||
+		(t._owner != _owner) ||
 		(t._transform != _transform)  ||
 		(t._dstRect != _dstRect) ||
 		(t._srcRect != _srcRect)
@@ -52,7 +52,7 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _owner(nullptr), _hash(0), _surface(nullptr) {}
 	~RenderTicket();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
@@ -68,9 +68,16 @@ public:
 	Graphics::TransformStruct _transform;
 
 	BaseSurfaceOSystem *_owner;
+	/**
+	 * Hash of the draw parameters compared by operator==, so that searching
+	 * the render queue for a matching ticket can reject most tickets early.
+	 */
+	uint32 _hash;
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
+	uint32 computeHash() const;
+
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
 };
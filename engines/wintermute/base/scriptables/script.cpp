@@ -1187,26 +1187,21 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScScript::getVar(char *name) {
 	ScValue *ret = nullptr;
+	const Common::String key(name);
 
 	// scope locals
 	if (_scopeStack->_sP >= 0) {
-		if (_scopeStack->getTop()->propExists(name)) {
-			ret = _scopeStack->getTop()->getProp(name);
-		}
+		ret = _scopeStack->getTop()->findProp(key);
 	}
 
 	// script globals
 	if (ret == nullptr) {
-		if (_globals->propExists(name)) {
-			ret = _globals->getProp(name);
-		}
+		ret = _globals->findProp(key);
 	}
 
 	// engine globals
 	if (ret == nullptr) {
-		if (_engine->_globals->propExists(name)) {
-			ret = _engine->_globals->getProp(name);
-		}
+		ret = _engine->_globals->findProp(key);
 	}
 
 	if (ret == nullptr) {
@@ -1263,6 +1258,7 @@ bool ScScript::sleep(uint32 duration) {
 		_waitTime = _gameRef->getTimer()->getTime() + duration;
 		_waitFrozen = false;
 	}
+	_engine->scheduleWakeUp(_waitFrozen, _waitTime);
 	return STATUS_OK;
 }
 
@@ -1455,6 +1451,9 @@ bool ScScript::resume() {
 	}
 
 	_state = _origState;
+	if (_state == SCRIPT_SLEEPING) {
+		_engine->scheduleWakeUp(_waitFrozen, _waitTime);
+	}
 	return STATUS_OK;
 }
 
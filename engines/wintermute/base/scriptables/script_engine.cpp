@@ -84,6 +84,9 @@ ScEngine::ScEngine(BaseGame *inGame) : BaseClass(inGame) {
 	_isProfiling = false;
 	_profilingStartTime = 0;
 
+	_nextRealWakeTime = 0;
+	_nextGameWakeTime = 0;
+
 	//EnableProfiling();
 }
 
@@ -277,6 +280,16 @@ bool ScEngine::tick() {
 	}
 
 
+	// Sleeping scripts are only looked at once the earliest of them is due
+	const uint32 realTime = g_system->getMillis();
+	const uint32 gameTime = _gameRef->getTimer()->getTime();
+	const bool wakeUpDue = realTime >= _nextRealWakeTime || gameTime >= _nextGameWakeTime;
+	if (wakeUpDue) {
+		// Rebuilt below from the scripts which keep sleeping
+		_nextRealWakeTime = 0xFFFFFFFF;
+		_nextGameWakeTime = 0xFFFFFFFF;
+	}
+
 	// resolve waiting scripts
 	for (uint32 i = 0; i < _scripts.size(); i++) {
 
@@ -306,14 +319,13 @@ bool ScEngine::tick() {
 		}
 
 		case SCRIPT_SLEEPING: {
-			if (_scripts[i]->_waitFrozen) {
-				if (_scripts[i]->_waitTime <= g_system->getMillis()) {
-					_scripts[i]->run();
-				}
+			if (!wakeUpDue) {
+				break;
+			}
+			if (_scripts[i]->_waitTime <= (_scripts[i]->_waitFrozen ? realTime : gameTime)) {
+				_scripts[i]->run();
 			} else {
-				if (_scripts[i]->_waitTime <= _gameRef->getTimer()->getTime()) {
-					_scripts[i]->run();
-				}
+				scheduleWakeUp(_scripts[i]->_waitFrozen, _scripts[i]->_waitTime);
 			}
 			break;
 		}
@@ -352,18 +364,21 @@ bool ScEngine::tick() {
 		// time sliced script
 		if (_scripts[i]->_timeSlice > 0) {
 			uint32 startTime = g_system->getMillis();
+			uint32 instructions = 0;
 			while (_scripts[i]->_state == SCRIPT_RUNNING && g_system->getMillis() - startTime < _scripts[i]->_timeSlice) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
-			if (_isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+			if (_isProfiling && _scripts[i]->_filename && instructions) {
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 
 		// normal script
 		else {
 			uint32 startTime = 0;
+			uint32 instructions = 0;
 			bool isProfiling = _isProfiling;
 			if (isProfiling) {
 				startTime = g_system->getMillis();
@@ -372,9 +387,10 @@ bool ScEngine::tick() {
 			while (_scripts[i]->_state == SCRIPT_RUNNING) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
-			if (isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+			if (isProfiling && _scripts[i]->_filename && instructions) {
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 		_currentScript = nullptr;
@@ -386,6 +402,16 @@ bool ScEngine::tick() {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::scheduleWakeUp(bool realTime, uint32 time) {
+	if (realTime) {
+		_nextRealWakeTime = MIN(_nextRealWakeTime, time);
+	} else {
+		_nextGameWakeTime = MIN(_nextGameWakeTime, time);
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::tickUnbreakable() {
 	ScScript *oldScript = _currentScript;
@@ -521,6 +547,10 @@ bool ScEngine::resetScript(ScScript *script) {
 bool ScEngine::persist(BasePersistenceManager *persistMgr) {
 	if (!persistMgr->getIsSaving()) {
 		cleanup();
+
+		// Look at the restored sleeping scripts on the next tick
+		_nextRealWakeTime = 0;
+		_nextGameWakeTime = 0;
 	}
 
 	persistMgr->transferPtr(TMEMBER_PTR(_gameRef));
@@ -583,14 +613,17 @@ bool ScEngine::clearGlobals(bool includingNatives) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::addScriptTime(const char *filename, uint32 time) {
+void ScEngine::addScriptTime(const char *filename, uint32 time, uint32 instructions) {
 	if (!_isProfiling) {
 		return;
 	}
 
 	AnsiString fileName = filename;
 	fileName.toLowercase();
-	_scriptTimes[fileName] += time;
+	ScriptProfile &profile = _scriptTimes[fileName];
+	profile._time += time;
+	profile._instructions += instructions;
+	profile._runs++;
 }
 
 
@@ -620,28 +653,38 @@ void ScEngine::disableProfiling() {
 
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+static bool scriptProfileLess(const ScEngine::ScriptProfile &a, const ScEngine::ScriptProfile &b) {
+	return a._time > b._time || (a._time == b._time && a._instructions > b._instructions);
+}
 
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
+Common::Array<ScEngine::ScriptProfile> ScEngine::getProfile() const {
+	Common::Array<ScriptProfile> profile;
+	for (ScriptTimes::const_iterator it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
+		profile.push_back(it->_value);
+		profile.back()._filename = it->_key;
+	}
+	Common::sort(profile.begin(), profile.end(), scriptProfileLess);
+	return profile;
+}
 
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
+
+//////////////////////////////////////////////////////////////////////////
+uint32 ScEngine::getProfilingTime() const {
+	return _isProfiling ? g_system->getMillis() - _profilingStartTime : 0;
+}
 
 
-	    TimeVector::reverse_iterator tit;
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::dumpStats() {
+	uint32 totalTime = MAX<uint32>(getProfilingTime(), 1);
+	Common::Array<ScriptProfile> profile = getProfile();
 
-	    _gameRef->LOG(0, "***** Script profiling information: *****");
-	    _gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+	_gameRef->LOG(0, "***** Script profiling information: *****");
+	_gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
 
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _gameRef->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+	for (uint32 i = 0; i < profile.size(); i++) {
+		_gameRef->LOG(0, "  %-40s %fs (%f%%), %u instructions in %u runs", profile[i]._filename.c_str(), (float)profile[i]._time / 1000, (float)profile[i]._time / (float)totalTime * 100, profile[i]._instructions, profile[i]._runs);
+	}
 }
 
 } // End of namespace Wintermute
@@ -84,6 +84,11 @@ public:
 	bool cleanup();
 	int getNumScripts(int *running = nullptr, int *waiting = nullptr, int *persistent = nullptr);
 	bool tick();
+	/**
+	 * Called when a script goes to sleep, so that tick() only looks at the
+	 * sleeping scripts once the earliest of them is due to wake up.
+	 */
+	void scheduleWakeUp(bool realTime, uint32 time);
 	ScValue *_globals;
 	ScScript *runScript(const char *filename, BaseScriptHolder *owner = nullptr);
 	bool isRunningScript(const char *filename);
@@ -103,16 +108,34 @@ public:
 		return _isProfiling;
 	}
 
-	void addScriptTime(const char *filename, uint32 Time);
+	void addScriptTime(const char *filename, uint32 Time, uint32 instructions = 0);
 	void dumpStats();
 
+	struct ScriptProfile {
+		Common::String _filename;
+		uint32 _time;
+		uint32 _instructions;
+		uint32 _runs;
+		ScriptProfile() : _time(0), _instructions(0), _runs(0) {}
+	};
+	/**
+	 * Get the profiling data collected since profiling was enabled,
+	 * sorted by execution time, most expensive script first.
+	 */
+	Common::Array<ScriptProfile> getProfile() const;
+	uint32 getProfilingTime() const;
+
 private:
 
 	CScCachedScript *_cachedScripts[MAX_CACHED_SCRIPTS];
 	bool _isProfiling;
 	uint32 _profilingStartTime;
 
-	typedef Common::HashMap<Common::String, uint32> ScriptTimes;
+	/** Earliest wake up time of the sleeping scripts by clock, 0xFFFFFFFF if none. */
+	uint32 _nextRealWakeTime;
+	uint32 _nextGameWakeTime;
+
+	typedef Common::HashMap<Common::String, ScriptProfile> ScriptTimes;
 	ScriptTimes _scriptTimes;
 
 };
@@ -130,16 +130,19 @@ void ScStack::correctParams(uint32 expectedParams) {
 	} else if (expectedParams > nuParams) { // need more params
 		while (expectedParams > nuParams) {
 			//Push(null_val);
-			ScValue *nullVal = new ScValue(_gameRef);
+			ScValue *nullVal;
+			if ((int32)_values.size() > _sP + 1) {
+				// Recycle the unused value above the stack pointer
+				nullVal = _values[_values.size() - 1];
+				_values.remove_at(_values.size() - 1);
+				nullVal->cleanup();
+			} else {
+				nullVal = new ScValue(_gameRef);
+			}
 			nullVal->setNULL();
 			_values.insert_at(_sP - nuParams + 1, nullVal);
 			nuParams++;
 			_sP++;
-
-			if ((int32)_values.size() > _sP + 1) {
-				delete _values[_values.size() - 1];
-				_values.remove_at(_values.size() - 1);
-			}
 		}
 	}
 }
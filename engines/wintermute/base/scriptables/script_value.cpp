@@ -222,19 +222,25 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 	if (DID_FAIL(ret)) {
 		ScValue *newVal = nullptr;
 
-		_valIter = _valObject.find(name);
+		const Common::String key(name);
+		_valIter = _valObject.find(key);
 		if (_valIter != _valObject.end()) {
 			newVal = _valIter->_value;
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
+			// Reuse the slot left behind by deleteProp(), if there is one
+			if (_valIter != _valObject.end()) {
+				_valIter->_value = newVal;
+			} else {
+				_valObject[key] = newVal;
+			}
 		} else {
 			newVal->cleanup();
 		}
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -259,6 +265,20 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::findProp(const Common::String &name) {
+	if (_type == VAL_VARIABLE_REF) {
+		return _valRef->findProp(name);
+	}
+
+	_valIter = _valObject.find(name);
+	if (_valIter != _valObject.end()) {
+		return _valIter->_value;
+	}
+	return nullptr;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::propExists(const char *name) {
 	if (_type == VAL_VARIABLE_REF) {
@@ -272,6 +292,11 @@ bool ScValue::propExists(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::deleteProps() {
+	// Most values never get any properties, and this runs on every stack push
+	if (_valObject.empty()) {
+		return;
+	}
+
 	_valIter = _valObject.begin();
 	while (_valIter != _valObject.end()) {
 		delete(ScValue *)_valIter->_value;
@@ -743,11 +768,12 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
-			_valObject[orig->_valIter->_key] = new ScValue(_gameRef);
-			_valObject[orig->_valIter->_key]->copy(orig->_valIter->_value);
+			ScValue *prop = new ScValue(_gameRef);
+			_valObject[orig->_valIter->_key] = prop;
+			prop->copy(orig->_valIter->_value);
 			orig->_valIter++;
 		}
-	} else {
+	} else if (!_valObject.empty()) {
 		_valObject.clear();
 	}
 }
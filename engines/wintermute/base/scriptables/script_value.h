@@ -83,6 +83,12 @@ public:
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	/**
+	 * Look up a property stored in this value itself, without asking the
+	 * native object. Equivalent to propExists() followed by getProp() for
+	 * plain objects, but with a single hash lookup.
+	 */
+	ScValue *findProp(const Common::String &name);
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 private:
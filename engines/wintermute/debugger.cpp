@@ -23,6 +23,8 @@
 #include "engines/wintermute/debugger.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_file_manager.h"
+#include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/base_surface_storage.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/debugger/debugger_controller.h"
 #include "engines/wintermute/wintermute.h"
@@ -36,6 +38,8 @@ Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
 	registerCmd("show_fps", WRAP_METHOD(Console, Cmd_ShowFps));
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
+	registerCmd("surface_cache", WRAP_METHOD(Console, Cmd_SurfaceCache));
+	registerCmd("script_profile", WRAP_METHOD(Console, Cmd_ScriptProfile));
 	registerCmd("help", WRAP_METHOD(Console, Cmd_Help));
 	// Actual (script) debugger commands
 	registerCmd(STEP_CMD, WRAP_METHOD(Console, Cmd_Step));
@@ -308,6 +312,73 @@ bool Console::Cmd_ShowFps(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_SurfaceCache(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: %s [<budget in MB>]\n", argv[0]);
+		return true;
+	}
+
+	BaseSurfaceStorage *storage = _engineRef->_game ? _engineRef->_game->_surfaceStorage : nullptr;
+	if (!storage) {
+		debugPrintf("No surface storage available\n");
+		return true;
+	}
+
+	if (argc == 2) {
+		// The budget is kept in bytes in a uint32
+		int budget = atoi(argv[1]);
+		if (budget <= 0 || budget >= 4096) {
+			debugPrintf("%s: the budget must be between 1 and 4095 MB\n", argv[0]);
+			return true;
+		}
+
+		storage->setMaxMemory((uint32)budget * 1024 * 1024);
+		// enforceMemoryBudget() evicts in list order, which is LRU order only
+		// after sorting
+		storage->sortSurfaces();
+		storage->enforceMemoryBudget(storage->_lastCleanupTime);
+	}
+
+	debugPrintf("Surfaces: %u\n", storage->_surfaces.size());
+	debugPrintf("Decoded: %u KB of %u KB\n", storage->getMemoryUsage() / 1024, storage->getMaxMemory() / 1024);
+	debugPrintf("Evictions: %u\n", storage->getNumEvictions());
+	return true;
+}
+
+bool Console::Cmd_ScriptProfile(int argc, const char **argv) {
+	if (!_engineRef->_game || !_engineRef->_game->_scEngine) {
+		debugPrintf("No script engine available\n");
+		return true;
+	}
+
+	if (argc == 2 && Common::String(argv[1]) == "on") {
+		CONTROLLER->setProfiling(true);
+		debugPrintf("Script profiling enabled\n");
+		return true;
+	} else if (argc == 2 && Common::String(argv[1]) == "off") {
+		// Also writes the collected data to the engine log
+		CONTROLLER->setProfiling(false);
+		debugPrintf("Script profiling disabled\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Usage: %s [on|off]\n", argv[0]);
+		return true;
+	}
+
+	if (!CONTROLLER->isProfiling()) {
+		debugPrintf("Script profiling is disabled, use \"%s on\" to enable it\n", argv[0]);
+		return true;
+	}
+
+	Common::Array<ScriptProfileInfo> profile = CONTROLLER->getScriptProfile();
+	debugPrintf("Profiling for %u ms, %u scripts\n", CONTROLLER->getProfilingTime(), profile.size());
+	debugPrintf("%-40s %8s %10s %6s\n", "Script", "Time", "Instr.", "Runs");
+	for (uint i = 0; i < profile.size() && i < 20; i++) {
+		debugPrintf("%-40s %6u ms %10u %6u\n", profile[i]._filename.c_str(), profile[i]._time, profile[i]._instructions, profile[i]._runs);
+	}
+	return true;
+}
+
 bool Console::Cmd_DumpFile(int argc, const char **argv) {
 	if (argc != 3) {
 		debugPrintf("Usage: %s <file path> <output file name>\n", argv[0]);
@@ -28,6 +28,7 @@
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/debugger/breakpoint.h"
@@ -260,6 +261,40 @@ void DebuggerController::showFps(bool show) {
 	_engine->_game->setShowFPS(show);
 }
 
+void DebuggerController::setProfiling(bool enable) {
+	assert(SCENGINE);
+	if (enable) {
+		SCENGINE->enableProfiling();
+	} else {
+		SCENGINE->disableProfiling();
+	}
+}
+
+bool DebuggerController::isProfiling() const {
+	assert(SCENGINE);
+	return SCENGINE->getIsProfiling();
+}
+
+Common::Array<ScriptProfileInfo> DebuggerController::getScriptProfile() const {
+	assert(SCENGINE);
+	Common::Array<ScEngine::ScriptProfile> profile = SCENGINE->getProfile();
+	Common::Array<ScriptProfileInfo> profileInfo;
+	for (uint i = 0; i < profile.size(); i++) {
+		ScriptProfileInfo info;
+		info._filename = profile[i]._filename;
+		info._time = profile[i]._time;
+		info._instructions = profile[i]._instructions;
+		info._runs = profile[i]._runs;
+		profileInfo.push_back(info);
+	}
+	return profileInfo;
+}
+
+uint32 DebuggerController::getProfilingTime() const {
+	assert(SCENGINE);
+	return SCENGINE->getProfilingTime();
+}
+
 Common::Array<BreakpointInfo> DebuggerController::getBreakpoints() const {
 	assert(SCENGINE);
 	Common::Array<BreakpointInfo> breakpoints;
@@ -50,6 +50,13 @@ struct WatchInfo {
 	bool _enabled;
 };
 
+struct ScriptProfileInfo {
+	Common::String _filename;
+	uint32 _time;
+	uint32 _instructions;
+	uint32 _runs;
+};
+
 struct TopEntry {
 	bool current;
 	Common::String filename;
@@ -106,6 +113,20 @@ public:
 	Common::String getSourcePath() const;
 	Listing *getListing(Error* &err);
 	void showFps(bool show);
+	/**
+	 * @brief start or stop recording the execution time and instructions of each script.
+	 * Stopping also writes the recorded profile to the engine log.
+	 */
+	void setProfiling(bool enable);
+	bool isProfiling() const;
+	/**
+	 * @brief get the profile recorded since profiling was started, most expensive script first.
+	 */
+	Common::Array<ScriptProfileInfo> getScriptProfile() const;
+	/**
+	 * @brief get the time in ms since profiling was started
+	 */
+	uint32 getProfilingTime() const;
 	/**
 	 * Inherited from ScriptMonitor
 	 */
@@ -48,7 +48,8 @@ namespace Image {
 JPEGDecoder::JPEGDecoder() :
 		_surface(),
 		_colorSpace(kColorSpaceRGB),
-		_requestedPixelFormat(getByteOrderRgbPixelFormat()) {
+		_requestedPixelFormat(getByteOrderRgbPixelFormat()),
+		_scaleDenominator(1) {
 }
 
 JPEGDecoder::~JPEGDecoder() {
@@ -272,6 +273,12 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		break;
 	}
 
+	if (_scaleDenominator != 1) {
+		assert(_scaleDenominator == 2 || _scaleDenominator == 4 || _scaleDenominator == 8);
+		cinfo.scale_num = 1;
+		cinfo.scale_denom = _scaleDenominator;
+	}
+
 	// Actually start decompressing the image
 	jpeg_start_decompress(&cinfo);
 
@@ -296,18 +303,18 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		break;
 	}
 
-	// Allocate buffer for one scanline
 	JDIMENSION pitch = cinfo.output_width * _surface.format.bytesPerPixel;
 	assert(_surface.pitch >= pitch);
-	JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
 
-	// Go through the image data scanline by scanline
+	// Have libjpeg write straight into the surface, a few scanlines at a time,
+	// rather than going through an intermediate scanline buffer
 	while (cinfo.output_scanline < cinfo.output_height) {
-		byte *dst = (byte *)_surface.getBasePtr(0, cinfo.output_scanline);
-
-		jpeg_read_scanlines(&cinfo, buffer, 1);
+		JSAMPROW rows[8];
+		JDIMENSION count = MIN<JDIMENSION>(ARRAYSIZE(rows), cinfo.output_height - cinfo.output_scanline);
+		for (JDIMENSION i = 0; i < count; i++)
+			rows[i] = (JSAMPROW)_surface.getBasePtr(0, cinfo.output_scanline + i);
 
-		memcpy(dst, buffer[0], pitch);
+		jpeg_read_scanlines(&cinfo, rows, count);
 	}
 
 	// We are done with decompressing, thus free all the data
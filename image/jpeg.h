@@ -102,10 +102,23 @@ public:
 	 */
 	void setOutputPixelFormat(const Graphics::PixelFormat &format) { _requestedPixelFormat = format; }
 
+	/**
+	 * Request a downscaled output. The scaling is done by the IDCT, which makes
+	 * it much faster than decoding the full image and scaling it afterwards.
+	 * This is useful for thumbnails.
+	 *
+	 * The decoder itself defaults to full size output.
+	 *
+	 * @param denominator The output size is divided by this value.
+	 *                    Supported values are 1, 2, 4 and 8.
+	 */
+	void setOutputScale(uint denominator) { _scaleDenominator = denominator; }
+
 private:
 	Graphics::Surface _surface;
 	ColorSpace _colorSpace;
 	Graphics::PixelFormat _requestedPixelFormat;
+	uint _scaleDenominator;
 
 	Graphics::PixelFormat getByteOrderRgbPixelFormat() const;
 };